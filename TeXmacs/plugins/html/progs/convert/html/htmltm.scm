@@ -651,6 +651,9 @@
 (tm-define (parse-html-document s)
   `(!file ,(htmltm-parse s)))
 
+(tm-define (parse-html-file-document u)
+  `(!file ,(htmltm-parse-file u)))
+
 (define (convert-html-texmacs html)
   (let* ((snippet? (not (func? html '!file 1)))
          (body (if snippet? html (cadr html)))
@@ -42,13 +42,18 @@
 
 (lazy-define (convert html htmltm) parse-html-snippet)
 (lazy-define (convert html htmltm) parse-html-document)
+(lazy-define (convert html htmltm) parse-html-file-document)
 (lazy-define (convert html htmltm) html->texmacs)
 (lazy-define (convert html htmlout) serialize-html)
 (lazy-define (convert html tmhtml) texmacs->html)
+(lazy-define (convert html tmhtml) texmacs->html-pages)
 
 (converter html-document html-stree
   (:function parse-html-document))
 
+(converter html-file html-stree
+  (:function parse-html-file-document))
+
 (converter html-stree html-document
   (:function serialize-html))
 
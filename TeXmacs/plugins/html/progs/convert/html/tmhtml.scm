@@ -2168,3 +2168,52 @@
              tmhtml-finalize-document
              tmhtml-finalize-selection)
          (tmhtml-root x)))))
+
+;; Pages are converted one by one, so links to labels on other pages
+;; are rewritten using a table of the pages of all labels, built first.
+
+(define (tmhtml-page-name i)
+  (string-append "page-" (number->string i) ".html"))
+
+(define (tmhtml-page-labels t i table)
+  (cond ((npair? t) (noop))
+        ((and (func? t 'label 1) (string? (cadr t)))
+         (ahash-set! table (cork->html (cadr t)) i))
+        (else (for-each (cut tmhtml-page-labels <> i table) (cdr t)))))
+
+(define (tmhtml-page-links t i table)
+  (cond ((npair? t) t)
+        ((and (== (car t) 'href) (pair? (cdr t)) (string? (cadr t))
+              (string-starts? (cadr t) "#"))
+         (with j (ahash-ref table (string-drop (cadr t) 1))
+           (if (and j (!= j i))
+               (list 'href (string-append (tmhtml-page-name j) (cadr t)))
+               t)))
+        (else (map (cut tmhtml-page-links <> i table) t))))
+
+(tm-define (texmacs->html-pages x opts dir)
+  ;; Export the chapters (or else the sections) of the document @x
+  ;; as the pages page-1.html, page-2.html, ... in @dir.  Each page is
+  ;; converted and streamed to disk before the next one is converted;
+  ;; its pictures are saved next to it.
+  (let* ((body (tmfile-extract x 'body))
+         (style* (tmfile-extract x 'style))
+         (style (if (list? style*) style* (list style*)))
+         (lan (tmfile-language x))
+         (path (url->string (get-texmacs-path)))
+         (what (if (list-find (cdr body) (cut func? <> 'chapter))
+                   "chapter" "section"))
+         (pages (map tree->stree
+                     (tree-children (html-split-pages body what))))
+         (nrs (.. 1 (+ (length pages) 1)))
+         (table (make-ahash-table))
+         (target current-save-target))
+    (for-each (cut tmhtml-page-labels <> <> table) pages nrs)
+    (for-each
+     (lambda (page i)
+       (let* ((doc (list '!file page style lan path))
+              (name (url-append dir (tmhtml-page-name i))))
+         (set! current-save-target name)
+         (html-save name (tmhtml-page-links (texmacs->html doc opts) i table))))
+     pages nrs)
+    (set! current-save-target target)))
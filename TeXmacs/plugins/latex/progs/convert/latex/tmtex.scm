@@ -46,6 +46,7 @@
 (define tmtex-appendices? #f)
 (define tmtex-indirect-bib? #f)
 (define tmtex-mathjax? #f)
+(define tmtex-paragraph-stamp #f)
 
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
 ;; Style
@@ -137,6 +138,8 @@
   (set! tmtex-auto-produce 0)
   (set! tmtex-auto-consume 0)
   (set! tmtex-mathjax? #f)
+  (set! tmtex-paragraph-stamp
+    (assoc-ref opts "texmacs->latex:paragraph-stamp"))
   (if (== (url-suffix current-save-target) "tex")
       (begin
         (set! tmtex-image-root-url (url-unglue current-save-target 4))
@@ -761,6 +764,65 @@
     (set! b (cons (car b) (cddr b))))
   b)
 
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;; Reuse of the conversions of unchanged paragraphs
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+;; The LaTeX trees of the paragraphs of the body are remembered under the
+;; paragraph, the state of the converter when starting with it, and a
+;; context made of the style, the initial environment, the preamble and the
+;; stamp of the options passed by tree_to_latex_document.  Paragraphs which
+;; modify the state (counters, languages, colors, pictures, ...) are not
+;; remembered, since their conversion has to be replayed.
+
+(define tmtex-paragraph-cache (make-ahash-table))
+(define tmtex-paragraph-cache-size 0)
+(define tmtex-paragraph-cache-max 4096)
+(define tmtex-paragraph-context #f)
+(define tmtex-paragraph-hits 0)
+(define tmtex-paragraph-misses 0)
+
+(define (tmtex-paragraph-state)
+  ;; variables which are reset to their previous values leave empty bindings
+  (list tmtex-serial tmtex-ref-cnt tmtex-auto-produce tmtex-auto-consume
+        tmtex-appendices? tmtex-languages tmtex-colors tmtex-colormaps
+        (list-filter (ahash-table->list tmtex-env)
+                     (lambda (x) (nnull? (cdr x))))
+        (ahash-table->list tmtex-dynamic)))
+
+(define (tmtex-paragraph x)
+  (let* ((state (tmtex-paragraph-state))
+         (key (list tmtex-paragraph-context state x))
+         (old (ahash-ref tmtex-paragraph-cache key)))
+    (if old
+        (begin
+          (set! tmtex-paragraph-hits (+ tmtex-paragraph-hits 1))
+          old)
+        (with r (tmtex x)
+          (set! tmtex-paragraph-misses (+ tmtex-paragraph-misses 1))
+          (when (== (tmtex-paragraph-state) state)
+            (when (>= tmtex-paragraph-cache-size tmtex-paragraph-cache-max)
+              (set! tmtex-paragraph-cache (make-ahash-table))
+              (set! tmtex-paragraph-cache-size 0))
+            (ahash-set! tmtex-paragraph-cache key r)
+            (set! tmtex-paragraph-cache-size
+                  (+ tmtex-paragraph-cache-size 1)))
+          r))))
+
+(define (tmtex-body x)
+  (if (and tmtex-paragraph-context (func? x 'document))
+      (cons '!document (map-in-order tmtex-paragraph (cdr x)))
+      (tmtex x)))
+
+(tm-define (tmtex-paragraph-statistics)
+  (list tmtex-paragraph-hits tmtex-paragraph-misses))
+
+(tm-define (tmtex-paragraph-reset)
+  (set! tmtex-paragraph-cache (make-ahash-table))
+  (set! tmtex-paragraph-cache-size 0)
+  (set! tmtex-paragraph-hits 0)
+  (set! tmtex-paragraph-misses 0))
+
 (define (tmtex-file l)
   (let* ((doc (car l))
          (styles (cadr l))
@@ -787,7 +849,11 @@
                            styles*))
              (preamble* (ahash-with tmtex-env :preamble #t
                           (map-in-order tmtex-pre doc-preamble)))
-             (body* (tmtex-postprocess-body (tmtex doc-body)))
+             (context (and tmtex-paragraph-stamp
+                           (list tmtex-paragraph-stamp styles init
+                                 tmtex-style tmtex-packages doc-preamble)))
+             (body* (with-global tmtex-paragraph-context context
+                      (tmtex-postprocess-body (tmtex-body doc-body))))
              (body** (tmtex-clean-body body*))
              (needs (list tmtex-languages tmtex-colors tmtex-colormaps)))
         (list '!file body** styles** needs init preamble*)))))
@@ -100,8 +100,7 @@
     ( ;; 1: load svg and transform to an active tree in
       ;; temporary buffer so that we can manipulate it
       ;; using texmacs primitives for trees
-      (svg-in (string-load dest)) ;; load svg file as string
-      (s-svg-in (parse-xml svg-in)) ;; parse to stree
+      (s-svg-in (parse-xml-file dest)) ;; parse the svg file to stree
       (mybuf (buffer-new))
       ;; create temporary buffer for subsequent manipulations of svg tree
       (void (buffer-set-body mybuf (tree-assign-node! (stree->tree s-svg-in)
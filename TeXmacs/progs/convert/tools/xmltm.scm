@@ -85,6 +85,9 @@
 (tm-define (htmltm-parse s)
   (xmltm-parse xmlns-uri-xhtml parse-html s))
 
+(tm-define (htmltm-parse-file u)
+  (xmltm-parse xmlns-uri-xhtml parse-html-file u))
+
 (tm-define (xmltm-parse default-ns parser s)
   (with-xmltm-environment
    env default-ns
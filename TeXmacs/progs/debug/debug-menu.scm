@@ -62,6 +62,8 @@
   (-> "Memory"
       ("Show memory usage in the console" (show-meminfo))
       ("Show memory usage in the footer" (set! footer-hook show-memory-information))
+      ("Show allocations per subsystem" (display* (allocation-report) "\n"))
+      ("Sample allocations every minute" (allocation-sampling 60000))
       ("Garbage collection" (delayed (:idle 1000) (gc))))
   (when (debug-get "correct")
     (-> "Mathematics"
@@ -125,6 +125,17 @@
          (l3 (append-map (cut string-tokenize-by-char <> path-separator) l2)))
     (build-doc-link-page what l3)))
 
+(define (indexgrep what where)
+  ;; the index of the folder is kept up to date by only scoring again
+  ;; the files which were modified since the previous search
+  (index-update (system->url where))
+  (let* ((dir (url->system (system->url where)))
+         (l1 (index-search what))
+         (l2 (list-filter l1 (lambda (x) (string-starts? (car x) dir))))
+         (l3 (list-filter l2 (lambda (x) (string-ends? (car x) ".tm"))))
+         (l4 (map (lambda (x) (cons (car x) (cadr x))) l3)))
+    (tm->stree (build-doc-search-results what l4))))
+
 ; TODO: include results from the code indexer when available
 (define (srcgrep what path . patterns)
   (let* ((l1 (map (lambda (pat) (url-collect path pat)) patterns))
@@ -153,7 +164,7 @@
            (docgrep what "$TEXMACS_FILE_PATH" "*.tm"))
           ((== type "texts-dir")
            (with where (query-ref query "where")
-             (docgrep what where "*.tm")))
+             (indexgrep what where)))
           ((== type "recent")
            (txtgrep what (recent-file-list 50)))
           ((== type "doc")
@@ -140,6 +140,20 @@
     (lambda (src)  (user-url "Destination directory" "directory"
       (lambda (dest) (tmweb-convert-directory src dest #t #f))))))
 
+(define (tmweb-html-options)
+  (map (lambda (opt) (cons opt (get-preference opt)))
+       (list "texmacs->html:css" "texmacs->html:mathjax"
+             "texmacs->html:mathml" "texmacs->html:images"
+             "texmacs->html:css-stylesheet")))
+
+(tm-define (tmweb-interactive-export-pages)
+  (:interactive #t)
+  (:synopsis "Export the chapters or sections of the buffer as web pages")
+  (user-url "Destination directory" "directory"
+    (lambda (dest)
+      (texmacs->html-pages (tree->stree (buffer-get (current-buffer)))
+                           (tmweb-html-options) dest))))
+
 (tm-widget ((website-widget src-dir dest-dir) cmd)
   (padded
     === ===
@@ -79,6 +79,8 @@
 "texmacs-time"
 "pretty-time"
 "texmacs-memory"
+"allocation-report"
+"allocation-sampling"
 "bench-print"
 "bench-print-all"
 "system-wait"
@@ -88,6 +90,7 @@
 "set-bibtex-command"
 "number-latex-errors"
 "number-latex-pages"
+"set-post-pass-skipping"
 "math-symbol-group"
 "math-group-members"
 "math-symbol-type"
@@ -470,6 +473,7 @@
 "cpp-verbatim->texmacs"
 "parse-latex"
 "parse-latex-document"
+"latex-reset-pieces"
 "latex->texmacs"
 "cpp-latex-document->texmacs"
 "latex-class-document->texmacs"
@@ -481,12 +485,16 @@
 "get-column-number"
 "try-latex-export"
 "parse-xml"
+"parse-xml-file"
 "parse-html"
+"parse-html-file"
 "parse-bib"
 "conservative-bib-import"
 "conservative-bib-export"
 "clean-html"
 "upgrade-mathml"
+"html-save"
+"html-split-pages"
 "retrieve-mathjax"
 "vernac->texmacs"
 "vernac-document->texmacs"
@@ -496,6 +504,8 @@
 "compute-index-string"
 "compute-index-tree"
 "compute-index-url"
+"index-update"
+"index-search"
 "url->url"
 "root->url"
 "string->url"
@@ -701,6 +711,8 @@
 "buffer-load"
 "buffer-export"
 "buffer-save"
+"buffer-verbatim-window"
+"buffer-verbatim-page"
 "tree-import-loaded"
 "tree-import"
 "tree-inclusion"
@@ -165,6 +165,9 @@
 (menu-bind load-menu
   ("Load" (open-document))
   ("Revert" (revert-buffer))
+  (if (verbatim-window?)
+      ("Previous lines" (verbatim-window-move -1))
+      ("Next lines" (verbatim-window-move 1)))
   (if (not (window-per-buffer?))
       ("Load in new window" (open-document*)))
   ---
@@ -77,6 +77,7 @@
       ("Count lines" (show-line-count)))
   ---
   ("Create web site" (open-website-builder))
+  ("Export as web pages" (tmweb-interactive-export-pages))
   ;;(-> "Web"
   ;;    ("Create web site" (tmweb-interactive-build))
   ;;    ("Update web site" (tmweb-interactive-update)))
@@ -150,16 +150,19 @@
 (define (save-buffer-save name opts)
   ;;(display* "save-buffer-save " name "\n")
   (with vname `(verbatim ,(utf8->cork (url->system name)))
-    (if (buffer-save name)
-        (begin
-          (buffer-pretend-modified name)
-          (set-message `(concat "Could not save " ,vname) "Save file"))
-        (begin
-          (if (== (url-suffix name) "ts") (style-clear-cache))
-          (autosave-remove name)
-          (buffer-notify-recent name)
-          (set-message `(concat "Saved " ,vname) "Save file")
-          (save-buffer-post name opts)))))
+    (cond
+      ((>= (buffer-verbatim-window name) 0)
+       (set-message `(concat "Only part of " ,vname " is loaded; not saved")
+                    "Save file"))
+      ((buffer-save name)
+       (buffer-pretend-modified name)
+       (set-message `(concat "Could not save " ,vname) "Save file"))
+      (else
+       (if (== (url-suffix name) "ts") (style-clear-cache))
+       (autosave-remove name)
+       (buffer-notify-recent name)
+       (set-message `(concat "Saved " ,vname) "Save file")
+       (save-buffer-post name opts)))))
 
 (define (save-buffer-check-faithful name opts)
   ;;(display* "save-buffer-check-faithful " name "\n")
@@ -539,10 +542,12 @@
           (when (!= name (current-buffer))
             (switch-to-buffer name))
           (url-cache-invalidate name)
-          (with t (tree-import name (url-format name))
-            (if (== t (tm->tree "error"))
-                (set-message "Error: file not found" "Revert buffer")
-                (buffer-set name t)))))))
+          (if (>= (buffer-verbatim-window name) 0)
+              (buffer-verbatim-page name 0)
+              (with t (tree-import name (url-format name))
+                (if (== t (tm->tree "error"))
+                    (set-message "Error: file not found" "Revert buffer")
+                    (buffer-set name t))))))))
 
 (tm-define (revert-buffer . l)
   (with name (if (null? l) (current-buffer) (car l))
@@ -552,6 +557,17 @@
             (when answ (apply revert-buffer-revert l))))
         (apply revert-buffer-revert l))))
 
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;; Browsing large verbatim files, which are loaded by windows of lines
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+(tm-define (verbatim-window?)
+  (>= (buffer-verbatim-window (current-buffer)) 0))
+
+(tm-define (verbatim-window-move delta)
+  (when (buffer-verbatim-page (current-buffer) delta)
+    (set-message "No more lines in this direction" "Browse file")))
+
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
 ;; Importing buffers
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
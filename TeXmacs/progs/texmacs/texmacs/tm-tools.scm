@@ -82,6 +82,8 @@
 (tm-define (clear-font-cache)
   (:synopsis "Clear font cache under TEXMACS_HOME_PATH and local cache path.")
   (system-remove (url-append (get-tm-cache-path) (string->url "font_cache.scm")))
+  (system-remove (url-append (get-tm-cache-path)
+                             (url-wildcard "font_cache.scm-*.bin")))
   (map (lambda (x)
         (system-remove (url-append (get-tm-cache-path)
                         (url-append (string->url "fonts") (string->url x)))))
@@ -0,0 +1,59 @@
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;
+;; MODULE      : conservative_bib.scm
+;; DESCRIPTION : Conservative exportation of BibTeX files
+;; COPYRIGHT   : (C) 2024  Darcy Shen
+;;
+;; This software falls under the GNU general public license version 3 or later.
+;; It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+;; in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+(import (srfi srfi-78))
+
+(define entry-a
+  (string-append "@article{alpha,\n    author = {Ann Author},\n"
+                 "    title  = {First},\n    year = 2001\n}\n"))
+(define entry-b
+  "@book{beta,\n  author={Bob Builder},   title={Second},\n  year={2002}}\n")
+(define entry-c
+  (string-append "% a comment which is kept as is\n"
+                 "@misc{gamma, title = \"Third\", year = 2003}\n"))
+
+(define source
+  (string-append "% hand written bibliography\n\n"
+                 entry-a "\n\n" entry-b "\n" entry-c "\n% the end\n"))
+
+(define (stree-replace t what by)
+  (cond ((== t what) by)
+        ((pair? t) (map (lambda (x) (stree-replace x what by)) t))
+        (else t)))
+
+(define (test-unchanged)
+  (let* ((t (zealous-bib-import source))
+         (u (tm->tree (tree->stree t))))
+    (check (conservative-bib-export t source u) => source)))
+
+(define (test-one-entry-changed)
+  (let* ((t (zealous-bib-import source))
+         (u (tm->tree (stree-replace (tree->stree t) "Second" "Revised")))
+         (r (conservative-bib-export t source u))
+         (before (string-append "% hand written bibliography\n\n"
+                                entry-a "\n\n"))
+         (after (string-append entry-c "\n% the end\n")))
+    (check (string-starts? r before) => #t)
+    (check (string-ends? r after) => #t)
+    (with middle (substring r (string-length before)
+                            (- (string-length r) (string-length after)))
+      (check (string-contains? middle "Revised") => #t)
+      (check (string-contains? middle "Second") => #f)
+      (check (string-contains? middle "beta") => #t))))
+
+(define (test_conservative_bib)
+  (set-preference "texmacs->bibtex:conservative" "on")
+  (test-unchanged)
+  (test-one-entry-changed)
+  (check-report)
+  (if (check-failed?) (exit -1)))
@@ -0,0 +1,50 @@
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;
+;; MODULE      : fromtex_post.scm
+;; DESCRIPTION : Skipped post-processing passes do not alter LaTeX imports,
+;;               and how much time they save on the test documents
+;; COPYRIGHT   : (C) 2024  Darcy Shen
+;;
+;; This software falls under the GNU general public license version 3 or later.
+;; It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+;; in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+(import (srfi srfi-78))
+
+(define (load-latex path)
+  (with path (string-append "$TEXMACS_PATH/tests/tex/" path)
+    (string-replace (string-load path) "\r\n" "\n")))
+
+(define (import-latex path skipping?)
+  (set-post-pass-skipping skipping?)
+  (with t (cpp-latex-document->texmacs (load-latex path) #f)
+    (set-post-pass-skipping #t)
+    (tree->stree t)))
+
+(define (check-same-import path)
+  (check (import-latex path #t) => (import-latex path #f)))
+
+(define test-documents
+  (list "43_2.tex" "43_3_a.tex" "43_3_empty.tex" "fromtex_post.tex"))
+
+(define bench-runs 10)
+
+(define (bench-import path skipping?)
+  (with start (texmacs-time)
+    (for (i (.. 0 bench-runs))
+      (import-latex path skipping?))
+    (display* path (if skipping? ", skipping: " ", full: ")
+              (quotient (- (texmacs-time) start) bench-runs) " ms\n")))
+
+(define (bench-paired-import path)
+  (bench-import path #t)
+  (bench-import path #f))
+
+(define (test_fromtex_post)
+  (for-each bench-paired-import test-documents)
+  (for-each check-same-import test-documents)
+  (check-report)
+  (if (check-failed?) (exit -1)))
@@ -0,0 +1,48 @@
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;
+;; MODULE      : parsetex_pieces.scm
+;; DESCRIPTION : The memoized pieces of LaTeX documents follow the macros
+;; COPYRIGHT   : (C) 2024  Darcy Shen
+;;
+;; This software falls under the GNU general public license version 3 or later.
+;; It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+;; in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+(import (srfi srfi-78))
+
+(define body
+  (string-append "\\begin{document}\n\n\\section{Body}\n\n"
+                 "\\foo{a}\\bar{b}\n\n\\end{document}\n"))
+
+(define (document foo bar)
+  (string-append "\\documentclass{article}\n\n" foo "\n\n" bar "\n\n" body))
+
+;; The two documents swap the arities and bodies of \foo and \bar,
+;; which leaves any order independent sum over the definitions unchanged
+(define doc-1
+  (document "\\newcommand{\\foo}[1]{[#1]}" "\\newcommand{\\bar}{x}"))
+(define doc-2
+  (document "\\newcommand{\\foo}{x}" "\\newcommand{\\bar}[1]{[#1]}"))
+(define doc-3
+  (document "\\newcommand{\\foo}[1]{[#1]}" "\\newcommand{\\bar}{y}"))
+
+(define (parse-fresh s)
+  (latex-reset-pieces)
+  (tree->stree (parse-latex-document s)))
+
+(define (parse-after before s)
+  (latex-reset-pieces)
+  (parse-latex-document before)
+  (tree->stree (parse-latex-document s)))
+
+(define (test_parsetex_pieces)
+  (check (== (parse-fresh doc-1) (parse-fresh doc-2)) => #f)
+  (check (parse-after doc-1 doc-1) => (parse-fresh doc-1))
+  (check (parse-after doc-1 doc-2) => (parse-fresh doc-2))
+  (check (parse-after doc-2 doc-1) => (parse-fresh doc-1))
+  (check (parse-after doc-1 doc-3) => (parse-fresh doc-3))
+  (check-report)
+  (if (check-failed?) (exit -1)))
@@ -0,0 +1,35 @@
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;
+;; MODULE      : parsetex_tokens.scm
+;; DESCRIPTION : The LaTeX parser dispatches on interned command names
+;; COPYRIGHT   : (C) 2024  Darcy Shen
+;;
+;; This software falls under the GNU general public license version 3 or later.
+;; It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+;; in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+(import (srfi srfi-78))
+
+(define (parsed s)
+  (object->string (tree->stree (parse-latex s))))
+
+(define (parses? s what)
+  (string-contains? (parsed s) what))
+
+(define (test_parsetex_tokens)
+  ;; Commands selected by a prefix of their name
+  (check (parses? "$a \\over b$" "frac") => #t)
+  (check (parses? "$\\overline{a}$" "frac") => #f)
+  (check (parses? "a\\hskip 1cm b" "hspace") => #t)
+  ;; Commands selected by their exact name
+  (check (parses? "$x\\sp{2}$" "sup") => #t)
+  (check (parses? "$x\\sb{2}$" "sub") => #t)
+  (check (parses? "\\href{http://x.org}{x}" "href") => #t)
+  ;; A comment character in verbatim material does not hide what follows
+  (check (parses? "\\verb|%|\\emph{later}" "later") => #t)
+  (check (parses? "\\verb|%|\\emph{later}" "emph") => #t)
+  (check-report)
+  (if (check-failed?) (exit -1)))
@@ -0,0 +1,57 @@
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;
+;; MODULE      : tracked_totex.scm
+;; DESCRIPTION : LaTeX exports reuse the conversions of unchanged paragraphs
+;; COPYRIGHT   : (C) 2024  Darcy Shen
+;;
+;; This software falls under the GNU general public license version 3 or later.
+;; It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+;; in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+(import (srfi srfi-78))
+
+(define style-name "tracked-totex-test")
+(define style-file
+  (string-append "$TEXMACS_HOME_PATH/styles/" style-name ".ts"))
+
+(define (document . pars)
+  `(document (TeXmacs "2.1")
+             (style (tuple "article" ,style-name))
+             (body (document ,@pars))))
+
+(define doc-1 (document "First paragraph." "Second $x$." "Third one."))
+(define doc-2 (document "First paragraph." "Second $y$." "Third one."))
+
+(define (export doc)
+  (tracked-texmacs->latex (stree->tree doc) '()))
+
+(define (exported doc)
+  ;; numbers of reused and converted paragraphs during the export
+  (with old (tmtex-paragraph-statistics)
+    (export doc)
+    (with new (tmtex-paragraph-statistics)
+      (list (- (car new) (car old)) (- (cadr new) (cadr old))))))
+
+(define (test_tracked_totex)
+  (system-mkdir (string->url "$TEXMACS_HOME_PATH/styles"))
+  (string-save "<TeXmacs|2.1>\n\n<style|source>\n\n<\\body>\n\n</body>\n"
+               (string->url style-file))
+  (with expected (export doc-1)
+    (tmtex-paragraph-reset)
+    ;; a fresh cache converts every paragraph
+    (check (exported doc-1) => '(0 3))
+    ;; an unchanged document reuses all of them, with the same result
+    (check (exported doc-1) => '(3 0))
+    (check (export doc-1) => expected)
+    ;; only the modified paragraph is converted again
+    (check (exported doc-2) => '(2 1))
+    ;; a modified style file invalidates everything
+    (system (string-append "touch -d @1000000000 " style-file))
+    (check (exported doc-1) => '(0 3))
+    (check (export doc-1) => expected))
+  (system-remove (string->url style-file))
+  (check-report)
+  (if (check-failed?) (exit -1)))
@@ -10,6 +10,7 @@
 
 #include <QtTest/QtTest>
 
+#include "alloc_stats.hpp"
 #include "base.hpp"
 #include "convert.hpp"
 #include "file.hpp"
@@ -22,6 +23,8 @@ private slots:
   void initTestCase () { init_lolly (); }
   void bench_texmacs_to_tree_data ();
   void bench_texmacs_to_tree ();
+  void bench_document_to_tree_data ();
+  void bench_document_to_tree ();
 };
 
 void
@@ -40,5 +43,25 @@ TestConverter::bench_texmacs_to_tree () {
   QBENCHMARK { texmacs_to_tree (file_content); };
 }
 
+void
+TestConverter::bench_document_to_tree_data () {
+  QTest::addColumn<url> ("file_name");
+  QTest::addColumn<bool> ("share");
+  url tm_base ("$TEXMACS_PATH/tests/tm/");
+  QTest::newRow ("29_1_1.tm") << tm_base * "29_1_1.tm" << false;
+  QTest::newRow ("29_1_1.tm shared") << tm_base * "29_1_1.tm" << true;
+  QTest::newRow ("64_1.tm") << tm_base * "64_1.tm" << false;
+  QTest::newRow ("64_1.tm shared") << tm_base * "64_1.tm" << true;
+}
+void
+TestConverter::bench_document_to_tree () {
+  QFETCH (url, file_name);
+  QFETCH (bool, share);
+  string file_content;
+  load_string (file_name, file_content, true);
+  alloc_watch watch (as_string (file_name));
+  QBENCHMARK { texmacs_document_to_tree (file_content, share); };
+}
+
 QTEST_MAIN (TestConverter)
 #include "convert_bench.moc"
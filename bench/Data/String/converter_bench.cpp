@@ -0,0 +1,68 @@
+/******************************************************************************
+ * MODULE     : converter_bench.cpp
+ * DESCRIPTION: Benchmarks on conversions between Cork and UTF-8
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "base.hpp"
+#include "converter.hpp"
+#include "file.hpp"
+#include "wencoding.hpp"
+Q_DECLARE_METATYPE (url)
+
+static void
+add_sample_files () {
+  QTest::addColumn<url> ("file_name");
+  url tm_base ("$TEXMACS_PATH/tests/tm/");
+  QTest::newRow ("29_1_1.tm") << tm_base * "29_1_1.tm";
+  QTest::newRow ("46_3.tm") << tm_base * "46_3.tm";
+  QTest::newRow ("64_1.tm") << tm_base * "64_1.tm";
+}
+
+class TestConverter : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase () { init_lolly (); }
+  void bench_looks_utf8_data () { add_sample_files (); }
+  void bench_looks_utf8 ();
+  void bench_utf8_to_cork_data () { add_sample_files (); }
+  void bench_utf8_to_cork ();
+  void bench_cork_to_utf8_data () { add_sample_files (); }
+  void bench_cork_to_utf8 ();
+};
+
+void
+TestConverter::bench_looks_utf8 () {
+  QFETCH (url, file_name);
+  string file_content;
+  load_string (file_name, file_content, true);
+  string content= cork_to_utf8 (file_content);
+  QBENCHMARK { looks_utf8 (content); };
+}
+
+void
+TestConverter::bench_utf8_to_cork () {
+  QFETCH (url, file_name);
+  string file_content;
+  load_string (file_name, file_content, true);
+  string content= cork_to_utf8 (file_content);
+  QBENCHMARK { utf8_to_cork (content); };
+}
+
+void
+TestConverter::bench_cork_to_utf8 () {
+  QFETCH (url, file_name);
+  string file_content;
+  load_string (file_name, file_content, true);
+  QBENCHMARK { cork_to_utf8 (file_content); };
+}
+
+QTEST_MAIN (TestConverter)
+#include "converter_bench.moc"
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * MODULE     : bibtex_functions_bench.cpp
+ * DESCRIPTION: Benchmarks on the primitives used by the bibliography styles
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "Bibtex/bibtex.hpp"
+#include "Bibtex/bibtex_functions.hpp"
+#include "base.hpp"
+#include "tree_helper.hpp"
+#include <moebius/data/scheme.hpp>
+
+using moebius::data::tree_to_scheme_tree;
+
+/******************************************************************************
+ * Synthetic entries, as passed to the styles
+ ******************************************************************************/
+
+static array<scheme_tree>
+bib_styled_entries (int n) {
+  string s;
+  for (int i= 0; i < n; i++) {
+    string k= as_string (i);
+    s << "@article{key" << k << ",\n";
+    s << "  author = {van der Berg, Jan-Peter and M{\\\"u}ller, Anna and "
+      << "John Smith" << k << "},\n";
+    s << "  title  = {On the {TeXmacs} approach, part " << k << "},\n";
+    s << "  year   = " << as_string (1980 + i % 40) << "\n}\n\n";
+  }
+  tree               t= parse_bib (s);
+  array<scheme_tree> r;
+  for (int i= 0; i < N (t); i++)
+    if (is_compound (t[i], "bib-entry")) r << tree_to_scheme_tree (t[i]);
+  return r;
+}
+
+// the work of the sort keys and labels of the plain and alpha styles
+static void
+bib_format_entries (array<scheme_tree> entries) {
+  for (int i= 0; i < N (entries); i++) {
+    scheme_tree names= bib_field (entries[i], "author");
+    for (int j= 1; j < N (names); j++) {
+      if (N (names[j]) < 5) continue;
+      for (int k= 1; k < 5; k++)
+        (void) bib_purify (names[j][k]);
+      (void) bib_prefix (names[j][3], 3);
+      (void) bib_abbreviate (names[j][1], "\".\"", tuple ("nbsp"));
+    }
+    (void) bib_purify (bib_field (entries[i], "title"));
+    (void) bib_text_length (bib_field (entries[i], "title"));
+    (void) bib_empty (entries[i], "editor");
+  }
+}
+
+static void
+add_entry_counts () {
+  QTest::addColumn<int> ("size");
+  QTest::newRow ("1000 entries") << 1000;
+  QTest::newRow ("5000 entries") << 5000;
+}
+
+static void
+add_entry_counts_and_memos () {
+  QTest::addColumn<int> ("size");
+  QTest::addColumn<bool> ("memo");
+  QTest::newRow ("1000 entries, cold") << 1000 << false;
+  QTest::newRow ("1000 entries, memoized") << 1000 << true;
+  QTest::newRow ("5000 entries, cold") << 5000 << false;
+  QTest::newRow ("5000 entries, memoized") << 5000 << true;
+}
+
+class TestBibtexFunctions : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase () { init_lolly (); }
+  void bench_format_entries_data () { add_entry_counts_and_memos (); }
+  void bench_format_entries ();
+  void bench_parse_names_data () { add_entry_counts (); }
+  void bench_parse_names ();
+};
+
+void
+TestBibtexFunctions::bench_format_entries () {
+  // the cold rows start each iteration with empty memos, as the first run
+  // of a style on a bibliography; the memoized rows only measure lookups
+  QFETCH (int, size);
+  QFETCH (bool, memo);
+  array<scheme_tree> entries= bib_styled_entries (size);
+  QBENCHMARK {
+    if (!memo) bib_reset_memos ();
+    bib_format_entries (entries);
+  };
+}
+
+void
+TestBibtexFunctions::bench_parse_names () {
+  QFETCH (int, size);
+  string names;
+  for (int i= 0; i < size; i++)
+    names << "van der Berg, Jan-Peter and M{\\\"u}ller, {\\'E}mile and ";
+  names << "John Smith";
+  QBENCHMARK {
+    int nb= 0;
+    (void) bib_names (names, nb);
+  };
+}
+
+QTEST_MAIN (TestBibtexFunctions)
+#include "bibtex_functions_bench.moc"
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * MODULE     : parsebib_bench.cpp
+ * DESCRIPTION: Benchmarks on the parsing of large BibTeX files
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "Bibtex/bibtex.hpp"
+#include "base.hpp"
+#include "tree_helper.hpp"
+
+/******************************************************************************
+ * Synthetic bibliography, shaped like a shared group bibliography
+ ******************************************************************************/
+
+static string
+bib_entry (int i) {
+  string k= as_string (i);
+  string r;
+  if (i % 3 == 0) r << "@article{key" << k << ",\n";
+  else if (i % 3 == 1) r << "@book{key" << k << ",\n";
+  else r << "@inproceedings{key" << k << ",\n";
+  r << "  author    = {Doe, John and M{\\\"u}ller, Anna and Smith, J.},\n";
+  r << "  title     = {On the {TeXmacs} approach to structured editing, "
+    << "part " << k << "},\n";
+  r << "  journal   = jcs,\n";
+  r << "  year      = " << as_string (1980 + i % 40) << ",\n";
+  r << "  pages     = \"" << k << "--" << as_string (i + 12) << "\",\n";
+  r << "  note      = {A rather long note which spans\n"
+    << "               several lines of the file}\n";
+  r << "}\n\n";
+  return r;
+}
+
+static string
+bib_corpus (int n) {
+  string r= "@string{jcs = {Journal of Computer Science}}\n\n";
+  for (int i= 0; i < n; i++)
+    r << bib_entry (i);
+  return r;
+}
+
+static void
+add_corpus_sizes () {
+  QTest::addColumn<int> ("size");
+  QTest::newRow ("1000 entries") << 1000;
+  QTest::newRow ("10000 entries") << 10000;
+  QTest::newRow ("50000 entries") << 50000;
+}
+
+class TestParseBib : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase () { init_lolly (); }
+  void bench_parse_bib_data () { add_corpus_sizes (); }
+  void bench_parse_bib ();
+};
+
+void
+TestParseBib::bench_parse_bib () {
+  QFETCH (int, size);
+  string s= bib_corpus (size);
+  QBENCHMARK { parse_bib (s); };
+}
+
+QTEST_MAIN (TestParseBib)
+#include "parsebib_bench.moc"
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * MODULE     : fromtex_post_bench.cpp
+ * DESCRIPTION: Benchmarks on the post-processing of imported LaTeX
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "Tex/tex.hpp"
+#include "base.hpp"
+#include "tree_helper.hpp"
+
+/******************************************************************************
+ * Synthetic corpus, shaped like the output of the LaTeX parser
+ ******************************************************************************/
+
+static tree
+plain_paragraph (int i) {
+  tree p (CONCAT);
+  p << ("Paragraph " * as_string (i) * " of the corpus, ");
+  p << " with some running text and a " << tree (NEW_LINE);
+  p << "line break in the middle.";
+  return p;
+}
+
+static tree
+styled_paragraph (int i) {
+  tree p (CONCAT);
+  p << "Some " << tree (WITH, "font-series", "bold", "bold text")
+    << tree (WITH, "font-series", "bold", " continued") << " and "
+    << tree (LABEL, "lab-" * as_string (i)) << " a label.";
+  p << tree (VSPACE, "0.5fn");
+  return p;
+}
+
+static tree
+corpus (int n, bool styled) {
+  tree doc (DOCUMENT);
+  for (int i= 0; i < n; i++)
+    doc << ((styled && (i % 4 == 0)) ? styled_paragraph (i)
+                                     : plain_paragraph (i));
+  return doc;
+}
+
+static void
+add_corpus_sizes () {
+  // paired rows, with and without the skipping of untriggered passes
+  QTest::addColumn<int> ("size");
+  QTest::addColumn<bool> ("skipping");
+  int sizes[]= {100, 1000, 10000};
+  for (int size : sizes) {
+    QByteArray name= QByteArray::number (size) + " paragraphs";
+    QTest::newRow ((name + ", skipping").constData ()) << size << true;
+    QTest::newRow ((name + ", full").constData ()) << size << false;
+  }
+}
+
+class TestFromtexPost : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase () { init_lolly (); }
+  void bench_finalize_plain_data () { add_corpus_sizes (); }
+  void bench_finalize_plain ();
+  void bench_finalize_styled_data () { add_corpus_sizes (); }
+  void bench_finalize_styled ();
+};
+
+void
+TestFromtexPost::bench_finalize_plain () {
+  QFETCH (int, size);
+  QFETCH (bool, skipping);
+  tree doc= corpus (size, false);
+  set_post_pass_skipping (skipping);
+  QBENCHMARK { finalize_textm (doc); };
+  set_post_pass_skipping (true);
+}
+
+void
+TestFromtexPost::bench_finalize_styled () {
+  QFETCH (int, size);
+  QFETCH (bool, skipping);
+  tree doc= corpus (size, true);
+  set_post_pass_skipping (skipping);
+  QBENCHMARK { finalize_textm (doc); };
+  set_post_pass_skipping (true);
+}
+
+QTEST_MAIN (TestFromtexPost)
+#include "fromtex_post_bench.moc"
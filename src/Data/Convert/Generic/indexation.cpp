@@ -13,11 +13,18 @@
 #include "convert.hpp"
 #include "file.hpp"
 #include "hashmap.hpp"
+#include "hashset.hpp"
 #include "iterator.hpp"
+#include "merge_sort.hpp"
 #include "tm_file.hpp"
 #include "tree_helper.hpp"
+#include <moebius/data/scheme.hpp>
 
 using namespace moebius;
+using moebius::data::block_to_scheme_tree;
+using moebius::data::scheme_tree_to_block;
+using moebius::data::scm_quote;
+using moebius::data::scm_unquote;
 
 /******************************************************************************
  * Computing scores for words in a file
@@ -175,3 +182,234 @@ compute_index (url u) {
   tree t= texmacs_document_to_tree (s);
   return compute_index (t, fm);
 }
+
+/******************************************************************************
+ * Persistent inverted index of document collections
+ ******************************************************************************/
+
+// For each term, the indexed files which contain it, with their scores.
+// The index is kept in the cache and files are only scored again when
+// their modification time or size changed. The indexed directories are
+// remembered, so that searches first catch up with the modified files.
+
+static bool                                  index_loaded = false;
+static bool                                  index_changed= false;
+static hashset<string>                      index_roots;
+static hashmap<string, tree>                 index_stamps (UNINIT);
+static hashmap<string, array<string>>        index_terms (array<string> ());
+static hashmap<string, hashmap<string, int>> index_postings (
+    hashmap<string, int> (0));
+
+static url
+index_file () {
+  return url ("$TEXMACS_HOME_PATH/system/cache/document_index.scm");
+}
+
+static tree
+index_stamp (url u) {
+  return tuple (as_string (last_modified (u, false)),
+                as_string (file_size (u)));
+}
+
+static void
+index_insert (string doc, tree stamp, array<string> terms, array<int> scores) {
+  for (int i= 0; i < N (terms); i++) {
+    if (!index_postings->contains (terms[i]))
+      index_postings (terms[i])= hashmap<string, int> (0);
+    index_postings (terms[i]) (doc)= scores[i];
+  }
+  index_stamps (doc)= stamp;
+  index_terms (doc) = terms;
+}
+
+static void
+index_remove (string doc) {
+  array<string> terms= index_terms[doc];
+  for (int i= 0; i < N (terms); i++)
+    if (index_postings->contains (terms[i])) {
+      hashmap<string, int> h= index_postings[terms[i]];
+      h->reset (doc);
+      if (N (h) == 0) index_postings->reset (terms[i]);
+    }
+  index_stamps->reset (doc);
+  index_terms->reset (doc);
+  index_changed= true;
+}
+
+static void
+index_load () {
+  if (index_loaded) return;
+  index_loaded= true;
+  url    u    = index_file ();
+  string s;
+  if (!exists (u) || load_string (u, s, false)) return;
+  tree t= block_to_scheme_tree (s);
+  for (int i= 0; i < N (t); i++)
+    if (is_tuple (t[i]) && N (t[i]) >= 1 && t[i][0] == "roots") {
+      for (int j= 1; j < N (t[i]); j++)
+        index_roots->insert (scm_unquote (t[i][j]->label));
+    }
+    else if (is_tuple (t[i]) && N (t[i]) >= 3 && is_atomic (t[i][0])) {
+      array<string> terms;
+      array<int>    scores;
+      for (int j= 3; j + 1 < N (t[i]); j+= 2) {
+        terms << scm_unquote (t[i][j]->label);
+        scores << as_int (t[i][j + 1]->label);
+      }
+      index_insert (scm_unquote (t[i][0]->label), tuple (t[i][1], t[i][2]),
+                    terms, scores);
+    }
+}
+
+static void
+index_save () {
+  if (!index_changed) return;
+  array<scheme_tree> r;
+  tree               roots= tuple ("roots");
+  iterator<string>   jt   = iterate (index_roots);
+  while (jt->busy ())
+    roots << scm_quote (jt->next ());
+  r << roots;
+  iterator<string> it= iterate (index_stamps);
+  while (it->busy ()) {
+    string        doc  = it->next ();
+    array<string> terms= index_terms[doc];
+    tree          entry= tuple (scm_quote (doc));
+    entry << A (index_stamps[doc]);
+    for (int i= 0; i < N (terms); i++)
+      entry << scm_quote (terms[i])
+            << as_string (index_postings[terms[i]][doc]);
+    r << entry;
+  }
+  url u  = index_file ();
+  url dir= head (u);
+  if (!exists (dir)) {
+    if (!exists (head (dir))) mkdir (head (dir));
+    mkdir (dir);
+  }
+  save_string (u, scheme_tree_to_block (tree (TUPLE, r)));
+  index_changed= false;
+}
+
+static bool
+is_indexable (url u) {
+  string suf= suffix (u);
+  return suf == "tm" || suf == "ts" || suf == "tmml" || suf == "scm" ||
+         suf == "tex" || suf == "bib" || suf == "txt" || suf == "md" ||
+         suf == "html";
+}
+
+static void
+index_update (url u, hashset<string>& seen) {
+  if (is_directory (u)) {
+    bool          err;
+    array<string> a= read_directory (u, err);
+    for (int i= 0; i < N (a); i++)
+      if (N (a[i]) != 0 && a[i][0] != '.') index_update (u * url (a[i]), seen);
+  }
+  else if (is_regular (u) && is_indexable (u)) {
+    string doc  = as_string (u);
+    tree   stamp= index_stamp (u);
+    seen->insert (doc);
+    if (index_stamps->contains (doc)) {
+      if (index_stamps[doc] == stamp) return;
+      index_remove (doc);
+    }
+    string s;
+    if (load_string (u, s, false)) return;
+    string         fm= get_format (s, suffix (u));
+    score_computer comp (fm);
+    if (fm == "texmacs") comp.compute (texmacs_document_to_tree (s));
+    else comp.compute (s);
+    array<int> scores;
+    for (int i= 0; i < N (comp.keys); i++)
+      scores << comp.score[comp.keys[i]];
+    index_insert (doc, stamp, comp.keys, scores);
+    index_changed= true;
+  }
+}
+
+static void
+index_refresh (url u) {
+  hashset<string> seen;
+  index_update (u, seen);
+  // forget about the files below u which no longer exist
+  string           prefix= as_string (u);
+  array<string>    gone;
+  iterator<string> it= iterate (index_stamps);
+  while (it->busy ()) {
+    string doc= it->next ();
+    if (starts (doc, prefix) && !seen->contains (doc) &&
+        !is_regular (url_system (doc)))
+      gone << doc;
+  }
+  for (int i= 0; i < N (gone); i++)
+    index_remove (gone[i]);
+}
+
+void
+index_update (url u) {
+  index_load ();
+  string root= as_string (u);
+  if (!index_roots->contains (root)) {
+    index_roots->insert (root);
+    index_changed= true;
+  }
+  index_refresh (u);
+  index_save ();
+}
+
+static void
+index_refresh () {
+  // rescan the indexed directories, only rescoring the modified files
+  array<string>    roots;
+  iterator<string> it= iterate (index_roots);
+  while (it->busy ())
+    roots << it->next ();
+  for (int i= 0; i < N (roots); i++) {
+    url u= url_system (roots[i]);
+    if (!exists (u)) {
+      index_roots->remove (roots[i]);
+      index_changed= true;
+    }
+    index_refresh (u);
+  }
+  index_save ();
+}
+
+struct index_less_eq_operator {
+  static bool leq (scheme_tree t1, scheme_tree t2) {
+    return as_int (t1[1]->label) >= as_int (t2[1]->label);
+  }
+};
+
+scheme_tree
+index_search (string query) {
+  index_load ();
+  index_refresh ();
+  array<string> terms= compute_keys (query, "verbatim");
+  for (int i= 0; i < N (terms); i++)
+    if (!index_postings->contains (terms[i])) return tree (TUPLE);
+  if (N (terms) == 0) return tree (TUPLE);
+
+  // only the files of the rarest term are candidates
+  int best= 0;
+  for (int i= 1; i < N (terms); i++)
+    if (N (index_postings[terms[i]]) < N (index_postings[terms[best]]))
+      best= i;
+  array<scheme_tree> r;
+  iterator<string>   it= iterate (index_postings[terms[best]]);
+  while (it->busy ()) {
+    string doc  = it->next ();
+    int    total= 0;
+    bool   all  = true;
+    for (int i= 0; i < N (terms) && all; i++) {
+      hashmap<string, int> h= index_postings[terms[i]];
+      all                   = h->contains (doc);
+      total+= h[doc];
+    }
+    if (all) r << tree (TUPLE, scm_quote (doc), as_string (total));
+  }
+  merge_sort_leq<scheme_tree, index_less_eq_operator> (r);
+  return tree (TUPLE, r);
+}
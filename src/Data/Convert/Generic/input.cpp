@@ -164,6 +164,58 @@ texmacs_input_rep::put (char c) { // returns true when expecting input
   return block_done;
 }
 
+static bool
+has_flush_trigger (int mode, char& trigger) {
+  // Character after which a non forced flush may actually emit output
+  switch (mode) {
+  case MODE_VERBATIM:
+  case MODE_UTF8:
+  case MODE_LATEX:
+    trigger= '\n';
+    return true;
+  case MODE_HTML:
+    trigger= '>';
+    return true;
+  default:
+    return false;
+  }
+}
+
+static inline bool
+is_data_delimiter (char c) {
+  return c == DATA_ESCAPE || c == DATA_BEGIN || c == DATA_END ||
+         c == DATA_ABORT;
+}
+
+bool
+texmacs_input_rep::put (string s) { // returns true when expecting input
+  // Bulk version of put (char): runs of plain characters in normal status
+  // are appended in one step; delimiters go through the character version
+  bool block_done= false;
+  int  i= 0, n= N (s);
+  while (i < n) {
+    if (status != STATUS_NORMAL || is_data_delimiter (s[i])) {
+      if (put (s[i])) block_done= true;
+      i++;
+      continue;
+    }
+    char trigger= '\0';
+    bool flushy = has_flush_trigger (mode, trigger);
+    int  j      = i;
+    if (flushy)
+      while (j < n && s[j] != trigger && !is_data_delimiter (s[j]))
+        j++;
+    else
+      while (j < n && !is_data_delimiter (s[j]))
+        j++;
+    if (flushy && j < n && s[j] == trigger) j++;
+    buf << s (i, j);
+    flush ();
+    i= j;
+  }
+  return block_done;
+}
+
 void
 texmacs_input_rep::bof () {
   format        = "verbatim";
@@ -14,6 +14,7 @@
 #include "path.hpp"
 #include "preferences.hpp"
 #include "tree_helper.hpp"
+#include "tree_share.hpp"
 
 #include <lolly/data/numeral.hpp>
 #include <lolly/data/unicode.hpp>
@@ -405,6 +406,15 @@ texmacs_document_to_tree (string s) {
   return error;
 }
 
+tree
+texmacs_document_to_tree (string s, bool share) {
+  // Documents which are only read, like style files, need not be editable:
+  // their identical atoms and small subtrees can then be stored only once
+  tree doc= texmacs_document_to_tree (s);
+  if (share && is_compound (doc)) doc= share_subtrees (doc);
+  return doc;
+}
+
 /******************************************************************************
  * Extracting attributes from a TeXmacs document tree
  ******************************************************************************/
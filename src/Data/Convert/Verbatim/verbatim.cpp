@@ -370,7 +370,11 @@ verbatim_to_tree (string s, bool wrap, string enc) {
 tree
 verbatim_document_to_tree (string s, bool wrap, string enc) {
   if (enc == "default") enc= "auto";
-  tree t   = verbatim_to_tree (s, wrap, enc);
+  return verbatim_body_to_document (verbatim_to_tree (s, wrap, enc));
+}
+
+tree
+verbatim_body_to_document (tree t) {
   tree init= tree (COLLECTION, tree (ASSOCIATE, LANGUAGE, "verbatim"),
                    tree (ASSOCIATE, FONT_FAMILY, "tt"),
                    tree (ASSOCIATE, PAR_FIRST, "0cm"));
@@ -0,0 +1,246 @@
+
+/******************************************************************************
+ * MODULE     : verbatim_lines.cpp
+ * DESCRIPTION: line indexed access to large verbatim files
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include "Verbatim/verbatim_lines.hpp"
+#include "convert.hpp"
+#include "file.hpp"
+#include "tm_file.hpp"
+#include "wencoding.hpp"
+
+#include <moebius/vars.hpp>
+#include <string.h>
+
+#if !defined(OS_WIN) && !defined(OS_WASM)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define VERBATIM_LINES_MMAP
+#endif
+
+using namespace moebius;
+
+#define VERBATIM_LINES_MAX 8            // number of indexes kept open
+#define VERBATIM_LINES_SAMPLE (1 << 20) // bytes used for detecting charsets
+#define VERBATIM_LINES_CACHE (1 << 16)  // converted lines kept per file
+
+/******************************************************************************
+ * Opening and closing
+ ******************************************************************************/
+
+verbatim_lines_rep::verbatim_lines_rep (url name2, string enc2)
+    : name (name2), enc (enc2), charset (""),
+      modified (last_modified (name2, false)), data (NULL), size (0), skip (0),
+      mapped (NULL), contents (""), starts (), cache (tree ()) {
+  map_file ();
+  if (mapped == NULL) read_file ();
+  build_index ();
+  detect_charset ();
+}
+
+verbatim_lines_rep::~verbatim_lines_rep () { unmap (); }
+
+verbatim_lines::verbatim_lines (url name, string enc)
+    : rep (tm_new<verbatim_lines_rep> (name, enc)) {}
+
+void
+verbatim_lines_rep::map_file () {
+#ifdef VERBATIM_LINES_MMAP
+  // Files which are still being written, like logs, are mapped as well:
+  // only their size at opening time is used, and check_file switches to
+  // a private copy if they are truncated later on
+  c_string    path (concretize (name));
+  int         fd= ::open (path, O_RDONLY);
+  struct stat st;
+  if (fd >= 0 && fstat (fd, &st) == 0 && st.st_size > 0 &&
+      st.st_size < ((off_t) 1 << 31)) {
+    void* p= mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED) {
+      mapped= p;
+      data  = (const char*) p;
+      size  = (int) st.st_size;
+    }
+  }
+  if (fd >= 0) ::close (fd);
+#endif
+}
+
+void
+verbatim_lines_rep::read_file () {
+  if (load_string (name, contents, false)) contents= "";
+  data= N (contents) == 0 ? NULL : &contents[0];
+  size= N (contents);
+}
+
+void
+verbatim_lines_rep::unmap () {
+#ifdef VERBATIM_LINES_MMAP
+  if (mapped != NULL) munmap (mapped, (size_t) size);
+#endif
+  mapped= NULL;
+}
+
+void
+verbatim_lines_rep::check_file () {
+  // Reading a mapping beyond the end of a truncated file raises SIGBUS,
+  // so we fall back to a private copy as soon as the file shrinks
+#ifdef VERBATIM_LINES_MMAP
+  if (mapped == NULL) return;
+  c_string    path (concretize (name));
+  struct stat st;
+  if (stat (path, &st) == 0 && st.st_size >= (off_t) size) return;
+  unmap ();
+  read_file ();
+  build_index ();
+  forget ();
+#endif
+}
+
+void
+verbatim_lines_rep::build_index () {
+  // Single pass over the contents; like verbatim_to_tree, both dos and
+  // mac line endings are accepted
+  starts= array<int> ();
+  starts << 0;
+  int i= 0;
+  while (i < size) {
+    const char* p= (const char*) memchr (data + i, '\n', size - i);
+    int         j= (p == NULL ? size : (int) (p - data));
+    for (int k= i; k < j; k++)
+      if (data[k] == '\r' && (k + 1 >= size || data[k + 1] != '\n'))
+        starts << (k + 1);
+    if (j < size) starts << (j + 1);
+    i= j + 1;
+  }
+}
+
+void
+verbatim_lines_rep::detect_charset () {
+  // The charset is guessed once for the whole file, as verbatim_to_tree
+  // does, and not line by line; large files are judged on their start
+  if (enc == "default") enc= "auto";
+  if (enc != "auto") return;
+  int n= min (size, VERBATIM_LINES_SAMPLE);
+  if (n < size) {
+    int m= n;
+    while (m > 0 && data[m - 1] != '\n')
+      m--;
+    if (m > 0) n= m;
+  }
+  string sample= (n == 0 ? string ("") : string (data, n));
+  if (looks_utf8_with_bom (sample)) skip= 3;
+  charset= western_charset (sample);
+  enc    = (charset == "" ? string ("iso-8859-1") : string ("utf-8"));
+}
+
+/******************************************************************************
+ * Access to the lines
+ ******************************************************************************/
+
+int
+verbatim_lines_rep::nr_lines () {
+  return N (starts);
+}
+
+string
+verbatim_lines_rep::raw_line (int i) {
+  int start= starts[i] + (i == 0 ? skip : 0);
+  int end  = (i + 1 < N (starts) ? starts[i + 1] - 1 : size);
+  if (end > start && data[end - 1] == '\r') end--;
+  if (end <= start) return "";
+  return string (data + start, end - start);
+}
+
+tree
+verbatim_lines_rep::convert_line (int i) {
+  if (!cache->contains (i)) {
+    if (N (cache) >= VERBATIM_LINES_CACHE) forget ();
+    string s= raw_line (i);
+    if (charset != "" && charset != "UTF-8") s= convert (s, charset, "UTF-8");
+    cache (i)= verbatim_to_tree (s, false, enc);
+  }
+  return cache[i];
+}
+
+tree
+verbatim_lines_rep::line (int i) {
+  check_file ();
+  return convert_line (i);
+}
+
+tree
+verbatim_lines_rep::lines (int start, int end) {
+  check_file ();
+  start= max (start, 0);
+  end  = min (end, nr_lines ());
+  tree doc (DOCUMENT);
+  for (int i= start; i < end; i++)
+    doc << convert_line (i);
+  if (N (doc) == 0) doc << tree ("");
+  return doc;
+}
+
+void
+verbatim_lines_rep::forget () {
+  cache= hashmap<int, tree> (tree ());
+}
+
+/******************************************************************************
+ * Indexes of recently opened files
+ ******************************************************************************/
+
+static hashmap<string, verbatim_lines> verbatim_lines_table;
+static array<string>                   verbatim_lines_recent;
+
+static void
+verbatim_lines_touch (string key) {
+  // Keep the most recently used indexes only; dropping an index from the
+  // table unmaps its file as soon as nobody else refers to it
+  array<string> others, a;
+  for (int i= 0; i < N (verbatim_lines_recent); i++)
+    if (verbatim_lines_recent[i] != key) others << verbatim_lines_recent[i];
+  int drop= N (others) - (VERBATIM_LINES_MAX - 1);
+  for (int i= 0; i < N (others); i++)
+    if (i < drop) verbatim_lines_table->reset (others[i]);
+    else a << others[i];
+  a << key;
+  verbatim_lines_recent= a;
+}
+
+verbatim_lines
+get_verbatim_lines (url u, string enc) {
+  string key= as_string (u) * "\t" * enc;
+  verbatim_lines_touch (key);
+  if (verbatim_lines_table->contains (key)) {
+    verbatim_lines vl= verbatim_lines_table[key];
+    if (vl->modified == last_modified (u, false) && vl->size == file_size (u))
+      return vl;
+  }
+  verbatim_lines vl (u, enc);
+  verbatim_lines_table (key)= vl;
+  return vl;
+}
+
+int
+verbatim_file_nr_lines (url u) {
+  return get_verbatim_lines (u)->nr_lines ();
+}
+
+tree
+verbatim_file_lines (url u, int start, int end, string enc) {
+  return get_verbatim_lines (u, enc)->lines (start, end);
+}
+
+tree
+verbatim_file_document (url u, int max_lines, string enc) {
+  verbatim_lines vl= get_verbatim_lines (u, enc);
+  return verbatim_body_to_document (vl->lines (0, max_lines));
+}
@@ -0,0 +1,63 @@
+
+/******************************************************************************
+ * MODULE     : verbatim_lines.hpp
+ * DESCRIPTION: line indexed access to large verbatim files
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#ifndef VERBATIM_LINES_H
+#define VERBATIM_LINES_H
+#include "hashmap.hpp"
+#include "tree.hpp"
+#include "url.hpp"
+
+/******************************************************************************
+ * The file is mapped into memory and only the offsets of the lines are
+ * computed when opening it; a mapped file which shrinks is replaced by a
+ * private copy. Lines are converted into trees when they are requested,
+ * and a bounded number of converted lines is cached.
+ ******************************************************************************/
+
+class verbatim_lines;
+struct verbatim_lines_rep : concrete_struct {
+  url                name;     // the indexed file
+  string             enc;      // encoding used for converting lines
+  string             charset;  // charset of the file, detected once
+  int                modified; // modification time when the file was indexed
+  const char*        data;     // start of the file contents
+  int                size;     // size of the file contents
+  int                skip;     // byte order mark at the start of the file
+  void*              mapped;   // memory mapping of the file (if any)
+  string             contents; // file contents when mapping is not possible
+  array<int>         starts;   // start offset of each line
+  hashmap<int, tree> cache;    // materialized lines
+
+  verbatim_lines_rep (url name, string enc);
+  ~verbatim_lines_rep ();
+  void   map_file ();
+  void   read_file ();
+  void   unmap ();
+  void   check_file ();
+  void   build_index ();
+  void   detect_charset ();
+  int    nr_lines ();
+  string raw_line (int i);
+  tree   convert_line (int i);
+  tree   line (int i);
+  tree   lines (int start, int end);
+  void   forget ();
+};
+
+class verbatim_lines {
+  CONCRETE_NULL (verbatim_lines);
+  verbatim_lines (url name, string enc= "default");
+};
+CONCRETE_NULL_CODE (verbatim_lines);
+
+verbatim_lines get_verbatim_lines (url u, string enc= "default");
+
+#endif // defined VERBATIM_LINES_H
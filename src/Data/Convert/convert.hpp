@@ -36,10 +36,13 @@ array<string> compute_keys (url u);
 scheme_tree   compute_index (string s, string fm);
 scheme_tree   compute_index (tree t, string fm);
 scheme_tree   compute_index (url u);
+void          index_update (url u);
+scheme_tree   index_search (string query);
 
 /*** Texmacs ***/
 tree                 texmacs_to_tree (string s);
 tree                 texmacs_document_to_tree (string s);
+tree                 texmacs_document_to_tree (string s, bool share);
 string               tree_to_texmacs (tree t);
 tree                 extract (tree doc, string attr);
 tree                 extract_document (tree doc);
@@ -62,6 +65,10 @@ string tree_to_tmu (tree t);
 string tree_to_verbatim (tree t, bool wrap= false, string enc= "default");
 tree   verbatim_to_tree (string s, bool wrap= false, string enc= "default");
 tree   verbatim_document_to_tree (string s, bool w= false, string e= "default");
+tree   verbatim_body_to_document (tree body);
 bool   is_verbatim (tree t);
+int    verbatim_file_nr_lines (url u);
+tree   verbatim_file_lines (url u, int start, int end, string enc= "default");
+tree   verbatim_file_document (url u, int max, string enc= "default");
 
 #endif // defined CONVERT_H
@@ -87,6 +87,26 @@ global_clear_history () {
   }
 }
 
+static long
+nr_modifications (patch p) {
+  if (get_type (p) == PATCH_MODIFICATION) return 1;
+  long r= 0;
+  for (int i= 0; i < N (p); i++)
+    r+= nr_modifications (p[i]);
+  return r;
+}
+
+long
+archived_modifications () {
+  long              r = 0;
+  iterator<pointer> it= iterate (archs);
+  while (it->busy ()) {
+    archiver_rep* arch= (archiver_rep*) it->next ();
+    r+= nr_modifications (arch->archive) + nr_modifications (arch->current);
+  }
+  return r;
+}
+
 void
 global_confirm () {
   iterator<pointer> it= iterate (pending_archs);
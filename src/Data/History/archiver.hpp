@@ -16,6 +16,7 @@
 void global_clear_history ();
 void global_confirm ();
 void global_cancel ();
+long archived_modifications ();
 
 class archiver_rep : public concrete_struct {
   patch    archive;       // undo and redo archive
@@ -76,6 +77,7 @@ public:
   friend void global_clear_history ();
   friend void global_confirm ();
   friend void global_cancel ();
+  friend long archived_modifications ();
 };
 
 class archiver {
@@ -10,6 +10,7 @@
  ******************************************************************************/
 
 #include "converter.hpp"
+#include "simd_ascii.hpp"
 #ifdef USE_ICONV
 #include <iconv.h>
 #endif
@@ -30,6 +31,7 @@ using lolly::data::to_Hex;
 using moebius::data::block_to_scheme_tree;
 
 #define from_hexadecimal from_hex
+#define PLAIN_LOOKAHEAD 64 // bytes scanned for ascii at once
 
 /******************************************************************************
  * converter methods
@@ -37,9 +39,15 @@ using moebius::data::block_to_scheme_tree;
 
 void
 operator<< (converter c, string str) {
-  int index= 0;
-  while (index < N (str))
-    c->match (str, index);
+  int index= 0, n= N (str);
+  while (index < n) {
+    int end= c->plain_end (str, index);
+    if (end > index) {
+      c->output << str (index, end);
+      index= end;
+    }
+    else c->match (str, index);
+  }
 }
 
 string
@@ -77,36 +85,98 @@ converter_rep::has_value (hashtree<char, string> node) {
   return node->label != nil_string;
 }
 
+inline int
+converter_rep::step (int state, unsigned char c) {
+  int lo= dfa[4 * state], hi= dfa[4 * state + 1];
+  if (c < lo || c >= hi) return -1;
+  return dfa_next[dfa[4 * state + 2] + c - lo];
+}
+
 inline void
 converter_rep::match (string& str, int& index) {
-  int                    forward   = index;
-  int                    last_match= -1;
-  string                 value ("");
-  bool                   done= false;
-  hashtree<char, string> node= ht;
-  // cout << "[";
-  while (!done && forward < N (str)) {
-    if (node->contains (str[forward])) {
-      node= node (str[forward]);
-      // printf("->%x",str[forward]);
-      if (has_value (node)) {
-        last_match= forward;
-        value     = node->label;
-      }
-      forward++;
+  int n= N (str), state= 0, last_match= -1, value= -1;
+  for (int i= index; i < n; i++) {
+    state= step (state, (unsigned char) str[i]);
+    if (state < 0) break;
+    if (dfa[4 * state + 3] >= 0) {
+      last_match= i;
+      value     = dfa[4 * state + 3];
     }
-    else done= true;
   }
   if (last_match == -1) {
-    if (copy_unmatched) output << string (str[index]);
+    if (copy_unmatched) output << str[index];
     index++;
   }
   else {
-    // printf(":");for(int i = 0; i < N(value);i++) printf("%x ",value[i]);
-    output << value;
+    output << dfa_value[value];
     index= last_match + 1;
   }
-  // cout << "]";
+}
+
+int
+converter_rep::plain_end (string& str, int index) {
+  // end of the run of ascii characters starting at index which are
+  // translated into themselves, so that they can be copied in one step;
+  // ascii runs are scanned by bounded chunks, since the run of plain
+  // characters often ends long before the ascii run (on quotes, ...)
+  int n= N (str);
+  if (index >= n) return index;
+  const char* s= &str[0];
+  int         i= index;
+  while (i < n) {
+    int start= i, len= min (n - i, PLAIN_LOOKAHEAD);
+    int end  = start + ascii_prefix (s + start, len);
+    while (i < end && plain[(unsigned char) s[i]])
+      i++;
+    if (i < start + len) break;
+  }
+  return i;
+}
+
+void
+converter_rep::compile () {
+  // number the nodes of the dictionary breadth first; each state only
+  // stores the transitions between its lowest and highest outgoing byte
+  array<hashtree<char, string>> nodes;
+  nodes << ht;
+  for (int k= 0; k < N (nodes); k++) {
+    hashtree<char, string> node= nodes[k];
+    int                    lo= 256, hi= 0;
+    for (int c= 0; c < 256; c++)
+      if (node->contains ((char) c)) {
+        lo= min (lo, c);
+        hi= c + 1;
+      }
+    if (hi == 0) lo= 0;
+    dfa << lo;
+    dfa << hi;
+    dfa << N (dfa_next);
+    for (int c= lo; c < hi; c++)
+      if (!node->contains ((char) c)) dfa_next << -1;
+      else {
+        dfa_next << N (nodes);
+        nodes << node ((char) c);
+      }
+    if (k == 0 || !has_value (node)) dfa << -1;
+    else {
+      dfa << N (dfa_value);
+      dfa_value << node->label;
+    }
+  }
+  ht= hashtree<char, string> ();
+}
+
+void
+converter_rep::init_plain () {
+  for (int c= 0; c < 128; c++) {
+    int next= step (0, (unsigned char) c);
+    if (next < 0) plain[c]= copy_unmatched;
+    else {
+      bool leaf= dfa[4 * next] >= dfa[4 * next + 1];
+      int  out = dfa[4 * next + 3];
+      plain[c] = leaf && out >= 0 && dfa_value[out] == string ((char) c);
+    }
+  }
 }
 
 void
@@ -250,6 +320,8 @@ converter_rep::load () {
     hashtree_from_dictionary (dic, "cork-to-real-ascii", UTF8, BIT2BIT, true);
     ht= dic;
   }
+  compile ();
+  init_plain ();
 }
 
 /******************************************************************************
@@ -351,7 +423,12 @@ utf8_to_cork (string input) {
   int       start, i, n= N (input);
   string    output;
   for (i= 0; i < n;) {
-    start            = i;
+    start= i;
+    i    = conv->plain_end (input, i);
+    if (i > start) {
+      output << input (start, i);
+      continue;
+    }
     unsigned int code= decode_from_utf8 (input, i);
     string       s   = input (start, i);
     string       r   = apply (conv, s);
@@ -367,7 +444,12 @@ utf8_to_hash_cork (string input) {
   int       start, i, n= N (input);
   string    output;
   for (i= 0; i < n;) {
-    start            = i;
+    start= i;
+    i    = conv->plain_end (input, i);
+    if (i > start) {
+      output << input (start, i);
+      continue;
+    }
     unsigned int code= decode_from_utf8 (input, i);
     string       s   = input (start, i);
     string       r   = apply (conv, s);
@@ -383,7 +465,12 @@ sourcecode_to_cork (string input) {
   int       start, i, n= N (input);
   string    output;
   for (i= 0; i < n;) {
-    start            = i;
+    start= i;
+    i    = conv->plain_end (input, i);
+    if (i > start) {
+      output << input (start, i);
+      continue;
+    }
     unsigned int code= decode_from_utf8 (input, i);
     string       s   = input (start, i);
     string       r   = apply (conv, s);
@@ -471,7 +558,12 @@ utf8_to_t2a (string_u8 input) {
   int       start, i, n= N (input);
   string    output;
   for (i= 0; i < n;) {
-    start            = i;
+    start= i;
+    i    = conv->plain_end (input, i);
+    if (i > start) {
+      output << input (start, i);
+      continue;
+    }
     unsigned int code= decode_from_utf8 (input, i);
     string       s   = input (start, i);
     string       r   = apply (conv, s);
@@ -33,8 +33,16 @@ struct converter_rep : rep<converter> {
   hashtree<char, string> ht;
   string                 output, nil_string, from, to;
   bool                   copy_unmatched;
+  bool                   plain[128]; // ascii characters copied unchanged
+  array<int>             dfa; // per state: first byte, end byte, offset, value
+  array<int>             dfa_next;  // transitions over the byte range
+  array<string>          dfa_value; // values of the states which end a key
   void                   match (string& str, int& index);
+  int                    plain_end (string& str, int index);
   void                   load ();
+  void                   compile ();
+  void                   init_plain ();
+  inline int             step (int state, unsigned char c);
 
 public:
   inline converter_rep (string from2, string to2)
@@ -55,6 +63,9 @@ public:
  * functions that operate on converters
  ******************************************************************************/
 
+// returns the converter between the given encodings, loading it if necessary
+converter load_converter (string from, string to);
+
 // takes a string str and returns its translation. strings contained in the
 // converter are lost in this process. the converter is empty when this
 // method returns.
@@ -0,0 +1,86 @@
+
+/******************************************************************************
+ * MODULE     : simd_ascii.hpp
+ * DESCRIPTION: Vectorized scanning of ASCII runs in byte strings
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#ifndef SIMD_ASCII_H
+#define SIMD_ASCII_H
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SIMD_ASCII_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMD_ASCII_SSE2
+#endif
+
+/******************************************************************************
+ * The routines below return the length of the longest prefix of s[0..n)
+ * satisfying some property; the scalar loops are the reference versions.
+ ******************************************************************************/
+
+inline int
+scalar_ascii_prefix (const char* s, int n) {
+  int i= 0;
+  while (i < n && ((unsigned char) s[i]) < 0x80)
+    i++;
+  return i;
+}
+
+inline int
+scalar_printable_ascii_prefix (const char* s, int n) {
+  int i= 0;
+  while (i < n && ((unsigned char) s[i]) >= 0x20 &&
+         ((unsigned char) s[i]) < 0x7F)
+    i++;
+  return i;
+}
+
+inline int
+ascii_prefix (const char* s, int n) {
+  // Bytes < 0x80
+  int i= 0;
+#ifdef SIMD_ASCII_AVX2
+  for (; i + 32 <= n; i+= 32) {
+    __m256i v   = _mm256_loadu_si256 ((const __m256i*) (s + i));
+    int     mask= _mm256_movemask_epi8 (v);
+    if (mask != 0) return i + scalar_ascii_prefix (s + i, 32);
+  }
+#endif
+#ifdef SIMD_ASCII_SSE2
+  for (; i + 16 <= n; i+= 16) {
+    __m128i v   = _mm_loadu_si128 ((const __m128i*) (s + i));
+    int     mask= _mm_movemask_epi8 (v);
+    if (mask != 0) return i + scalar_ascii_prefix (s + i, 16);
+  }
+#endif
+  return i + scalar_ascii_prefix (s + i, n - i);
+}
+
+inline int
+printable_ascii_prefix (const char* s, int n) {
+  // Bytes in the range 0x20..0x7E
+  int i= 0;
+#ifdef SIMD_ASCII_SSE2
+  const __m128i lo= _mm_set1_epi8 (0x1F);
+  const __m128i hi= _mm_set1_epi8 (0x7F);
+  for (; i + 16 <= n; i+= 16) {
+    // signed comparisons also reject the bytes >= 0x80
+    __m128i v = _mm_loadu_si128 ((const __m128i*) (s + i));
+    __m128i ok= _mm_and_si128 (_mm_cmpgt_epi8 (v, lo), _mm_cmplt_epi8 (v, hi));
+    if (_mm_movemask_epi8 (ok) != 0xFFFF)
+      return i + scalar_printable_ascii_prefix (s + i, 16);
+  }
+#endif
+  return i + scalar_printable_ascii_prefix (s + i, n - i);
+}
+
+#endif // defined SIMD_ASCII_H
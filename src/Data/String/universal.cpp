@@ -23,6 +23,68 @@ using lolly::data::to_Hex;
 
 using lolly::data::encode_as_utf8;
 
+/******************************************************************************
+ * Two level tables indexed by code points
+ ******************************************************************************/
+
+// One pointer per page of 256 code points; pages without entries are NULL,
+// so that lookups for most scripts cost a single test.
+
+#define UNI_PAGES 0x1100
+
+typedef int* code_table[UNI_PAGES];
+
+static void
+code_table_set (code_table& t, int code, int val, int def) {
+  int*& page= t[code >> 8];
+  if (page == NULL) {
+    page= tm_new_array<int> (256);
+    for (int i= 0; i < 256; i++)
+      page[i]= (def == -1 ? -1 : ((code & ~255) + i));
+  }
+  page[code & 255]= val;
+}
+
+// the default is the code point itself, or -1 for partial tables
+static inline int
+code_table_get (code_table& t, int code, int def) {
+  if (code < 0 || code >= (UNI_PAGES << 8)) return def == -1 ? -1 : code;
+  int* page= t[code >> 8];
+  if (page == NULL) return def == -1 ? -1 : code;
+  return page[code & 255];
+}
+
+// decode the character <#...> in s (start, end), or return -1
+static inline int
+uni_decode_hex (string& s, int start, int end) {
+  if (end - start < 4 || end - start > 10) return -1;
+  if (s[start + 1] != '#' || s[end - 1] != '>') return -1;
+  int code= 0;
+  for (int i= start + 2; i < end - 1; i++) {
+    char c= s[i];
+    if (c >= '0' && c <= '9') code= (code << 4) + (c - '0');
+    else if (c >= 'A' && c <= 'F') code= (code << 4) + (c - 'A' + 10);
+    else if (c >= 'a' && c <= 'f') code= (code << 4) + (c - 'a' + 10);
+    else return -1;
+  }
+  return code;
+}
+
+// append <#...> as to_Hex does, without intermediate strings
+static inline void
+uni_append_hex (string& r, int code) {
+  char buf[8];
+  int  n= 0;
+  do {
+    buf[n++]= "0123456789ABCDEF"[code & 15];
+    code>>= 4;
+  } while (code != 0 && n < 8);
+  r << '<' << '#';
+  while (n > 0)
+    r << buf[--n];
+  r << '>';
+}
+
 /******************************************************************************
  * Transliteration
  ******************************************************************************/
@@ -45,11 +107,16 @@ char Cork_unaccented[128]= {
     'e', 'e', 'e', 'i', 'i', 'i', 'i', 'd', 'n', 'o', 'o', 'o', 'o', 'o', ' ',
     ' ', 'u', 'u', 'u', 'u', 'y', ' ', ' '};
 
+static code_table    translit_codes;
+static array<string> translit_values;
+
 static void
 translit_set (int i, string s) {
   string h                                    = to_Hex (i);
   translit_table ("<#" * locase_all (h) * ">")= s;
   translit_table ("<#" * upcase_all (h) * ">")= s;
+  code_table_set (translit_codes, i, N (translit_values), -1);
+  translit_values << s;
 }
 
 static void
@@ -139,11 +206,23 @@ uni_translit (string s) {
   string r;
   int    i= 0, n= N (s);
   while (i < n) {
+    unsigned char c= s[i];
+    if (c != '<') {
+      if (c >= 128 && Cork_unaccented[c - 128] != ' ')
+        r << Cork_unaccented[c - 128];
+      else r << (char) c;
+      i++;
+      continue;
+    }
     int start= i;
     tm_char_forwards (s, i);
-    string ss= s (start, i);
-    if (translit_table->contains (ss)) r << translit_table[ss];
-    else r << ss;
+    // the table only knows the spellings of to_Hex, without leading zeros
+    int code= uni_decode_hex (s, start, i);
+    int k   = -1;
+    if (code >= 0 && s[start + 2] != '0')
+      k= code_table_get (translit_codes, code, -1);
+    if (k >= 0) r << translit_values[k];
+    else r << s (start, i);
   }
   return r;
 }
@@ -213,51 +292,109 @@ init_case_tables () {
   add_greek ("omega");
 }
 
-string
-uni_locase_char (string s) {
-  if (N (s) == 1) {
-    unsigned char c= s[0];
-    if ((is_iso_upcase (c)) ||
-        (c >= ((unsigned char) 0x80) && (c <= ((unsigned char) 0x9F))) ||
-        (c >= ((unsigned char) 0xC0) && (c <= ((unsigned char) 0xDF))))
-      return string ((char) (c + 0x20));
-    return s;
-  }
-  else if (starts (s, "<#") && ends (s, ">")) {
-    int code= from_hexadecimal (s (2, N (s) - 1));
-    if (code >= 0x100 && code <= 0x17F) {
-      if (code == 0x138 || code == 0x149 || code == 0x178 || code == 0x17F)
-        ;
-      else if ((code > 0x138 && code < 0x149) ||
-               (code > 0x178 && code < 0x17F)) {
-        if ((code & 1) == 1) code+= 1;
-      }
-      else if ((code & 1) == 0) code+= 1;
+static int
+uni_locase_rule (int code) {
+  if (code >= 0x100 && code <= 0x17F) {
+    if (code == 0x138 || code == 0x149 || code == 0x178 || code == 0x17F)
+      ;
+    else if ((code > 0x138 && code < 0x149) || (code > 0x178 && code < 0x17F)) {
+      if ((code & 1) == 1) code+= 1;
     }
-    else if (code >= 0x180 && code <= 0x24F) {
-      if (code <= 0x181 || code == 0x186 || code == 0x18D ||
-          (code >= 0x18E && code <= 0x1CC) || code == 0x1DD ||
-          (code >= 0x1F0 && code <= 0x1F3) || code >= 0x23A)
-        ; // FIXME: some characters not treated
-      else if ((code > 0x186 && code < 0x18D) ||
-               (code > 0x1CC && code < 0x1DD)) {
-        if ((code & 1) == 1) code+= 1;
-      }
-      else if ((code & 1) == 0) code+= 1;
+    else if ((code & 1) == 0) code+= 1;
+  }
+  else if (code >= 0x180 && code <= 0x24F) {
+    if (code <= 0x181 || code == 0x186 || code == 0x18D ||
+        (code >= 0x18E && code <= 0x1CC) || code == 0x1DD ||
+        (code >= 0x1F0 && code <= 0x1F3) || code >= 0x23A)
+      ; // FIXME: some characters not treated
+    else if ((code > 0x186 && code < 0x18D) || (code > 0x1CC && code < 0x1DD)) {
+      if ((code & 1) == 1) code+= 1;
     }
-    else if (code >= 0x386 && code <= 0x3AB) {
-      if (code >= 0x391 && code <= 0x3AB) code+= 0x20;
-      else if (code >= 0x386 && code <= 0x386) code+= 0x26;
-      else if (code >= 0x388 && code <= 0x38A) code+= 0x25;
-      else if (code >= 0x38C && code <= 0x38C) code+= 0x40;
-      else if (code >= 0x38E && code <= 0x38F) code+= 0x3f;
+    else if ((code & 1) == 0) code+= 1;
+  }
+  else if (code >= 0x386 && code <= 0x3AB) {
+    if (code >= 0x391 && code <= 0x3AB) code+= 0x20;
+    else if (code >= 0x386 && code <= 0x386) code+= 0x26;
+    else if (code >= 0x388 && code <= 0x38A) code+= 0x25;
+    else if (code >= 0x38C && code <= 0x38C) code+= 0x40;
+    else if (code >= 0x38E && code <= 0x38F) code+= 0x3f;
+  }
+  else if (code >= 0x400 && code <= 0x40F) code+= 0x50;
+  else if (code >= 0x410 && code <= 0x42F) code+= 0x20;
+  else if (code >= 0x460 && code <= 0x4FF) {
+    if ((code & 1) == 0) code+= 1;
+  }
+  return code;
+}
+
+static int
+uni_upcase_rule (int code) {
+  if (code >= 0x100 && code <= 0x17F) {
+    if (code == 0x138 || code == 0x149 || code == 0x178 || code == 0x17F)
+      ;
+    else if ((code > 0x138 && code < 0x149) || (code > 0x178 && code < 0x17F)) {
+      if ((code & 1) == 0) code-= 1;
     }
-    else if (code >= 0x400 && code <= 0x40F) code+= 0x50;
-    else if (code >= 0x410 && code <= 0x42F) code+= 0x20;
-    else if (code >= 0x460 && code <= 0x4FF) {
-      if ((code & 1) == 0) code+= 1;
+    else if ((code & 1) == 1) code-= 1;
+  }
+  else if (code >= 0x180 && code <= 0x24F) {
+    if (code <= 0x181 || code == 0x186 || code == 0x18D ||
+        (code >= 0x18E && code <= 0x1CC) || code == 0x1DD ||
+        (code >= 0x1F0 && code <= 0x1F3) || code >= 0x23A)
+      ; // FIXME: some characters not treated
+    else if ((code > 0x186 && code < 0x18D) || (code > 0x1CC && code < 0x1DD)) {
+      if ((code & 1) == 0) code-= 1;
     }
-    return "<#" * to_Hex (code) * ">";
+    else if ((code & 1) == 1) code-= 1;
+  }
+  else if (code >= 0x3AC && code <= 0x3CE) {
+    if (code >= 0x3B1 && code <= 0x3CB) code-= 0x20;
+    else if (code >= 0x3AC && code <= 0x3AC) code-= 0x26;
+    else if (code >= 0x3AD && code <= 0x3AF) code-= 0x25;
+    else if (code >= 0x3CC && code <= 0x3CC) code-= 0x40;
+    else if (code >= 0x3CD && code <= 0x3CE) code-= 0x3f;
+  }
+  else if (code >= 0x450 && code <= 0x45F) code-= 0x50;
+  else if (code >= 0x430 && code <= 0x44F) code-= 0x20;
+  else if (code >= 0x460 && code <= 0x4FF) {
+    if ((code & 1) == 1) code-= 1;
+  }
+  return code;
+}
+
+// the rules above only change code points below 0x500
+static code_table locase_codes, upcase_codes;
+static char       locase_bytes[256], upcase_bytes[256];
+static bool       case_codes_done= false;
+
+static void
+init_case_codes () {
+  if (case_codes_done) return;
+  for (int code= 0x100; code < 0x500; code++) {
+    int lo= uni_locase_rule (code), up= uni_upcase_rule (code);
+    if (lo != code) code_table_set (locase_codes, code, lo, 0);
+    if (up != code) code_table_set (upcase_codes, code, up, 0);
+  }
+  for (int i= 0; i < 256; i++) {
+    unsigned char c= (unsigned char) i;
+    locase_bytes[i]= (char) c;
+    upcase_bytes[i]= (char) c;
+    if (is_iso_upcase (c) || (c >= 0x80 && c <= 0x9F) ||
+        (c >= 0xC0 && c <= 0xDF))
+      locase_bytes[i]= (char) (c + 0x20);
+    if (is_iso_locase (c) || (c >= 0xA0 && c <= 0xBF) || c >= 0xE0)
+      upcase_bytes[i]= (char) (c - 0x20);
+  }
+  case_codes_done= true;
+}
+
+string
+uni_locase_char (string s) {
+  init_case_codes ();
+  if (N (s) == 1) return string (locase_bytes[(unsigned char) s[0]]);
+  else if (starts (s, "<#") && ends (s, ">")) {
+    int code= from_hexadecimal (s (2, N (s) - 1));
+    return "<#" * to_Hex (code_table_get (locase_codes, code, 0)) * ">";
   }
   else {
     init_case_tables ();
@@ -268,49 +405,11 @@ uni_locase_char (string s) {
 
 string
 uni_upcase_char (string s) {
-  if (N (s) == 1) {
-    unsigned char c= s[0];
-    if ((is_iso_locase (c)) ||
-        (c >= ((unsigned char) 0xA0) && (c <= ((unsigned char) 0xBF))) ||
-        (c >= ((unsigned char) 0xE0)))
-      return string ((char) (c - 0x20));
-    return s;
-  }
+  init_case_codes ();
+  if (N (s) == 1) return string (upcase_bytes[(unsigned char) s[0]]);
   else if (starts (s, "<#") && ends (s, ">")) {
     int code= from_hexadecimal (s (2, N (s) - 1));
-    if (code >= 0x100 && code <= 0x17F) {
-      if (code == 0x138 || code == 0x149 || code == 0x178 || code == 0x17F)
-        ;
-      else if ((code > 0x138 && code < 0x149) ||
-               (code > 0x178 && code < 0x17F)) {
-        if ((code & 1) == 0) code-= 1;
-      }
-      else if ((code & 1) == 1) code-= 1;
-    }
-    else if (code >= 0x180 && code <= 0x24F) {
-      if (code <= 0x181 || code == 0x186 || code == 0x18D ||
-          (code >= 0x18E && code <= 0x1CC) || code == 0x1DD ||
-          (code >= 0x1F0 && code <= 0x1F3) || code >= 0x23A)
-        ; // FIXME: some characters not treated
-      else if ((code > 0x186 && code < 0x18D) ||
-               (code > 0x1CC && code < 0x1DD)) {
-        if ((code & 1) == 0) code-= 1;
-      }
-      else if ((code & 1) == 1) code-= 1;
-    }
-    else if (code >= 0x3AC && code <= 0x3CE) {
-      if (code >= 0x3B1 && code <= 0x3CB) code-= 0x20;
-      else if (code >= 0x3AC && code <= 0x3AC) code-= 0x26;
-      else if (code >= 0x3AD && code <= 0x3AF) code-= 0x25;
-      else if (code >= 0x3CC && code <= 0x3CC) code-= 0x40;
-      else if (code >= 0x3CD && code <= 0x3CE) code-= 0x3f;
-    }
-    else if (code >= 0x450 && code <= 0x45F) code-= 0x50;
-    else if (code >= 0x430 && code <= 0x44F) code-= 0x20;
-    else if (code >= 0x460 && code <= 0x4FF) {
-      if ((code & 1) == 1) code-= 1;
-    }
-    return "<#" * to_Hex (code) * ">";
+    return "<#" * to_Hex (code_table_get (upcase_codes, code, 0)) * ">";
   }
   else {
     init_case_tables ();
@@ -319,6 +418,28 @@ uni_upcase_char (string s) {
   }
 }
 
+// apply the case tables to the characters of s from position i on
+static string
+uni_change_case (string s, int i, code_table& codes, char* bytes,
+                 string (*change_char) (string)) {
+  init_case_codes ();
+  string r= s (0, i);
+  int    n= N (s);
+  while (i < n) {
+    if (s[i] != '<') {
+      r << bytes[(unsigned char) s[i]];
+      i++;
+      continue;
+    }
+    int start= i;
+    tm_char_forwards (s, i);
+    int code= uni_decode_hex (s, start, i);
+    if (code >= 0) uni_append_hex (r, code_table_get (codes, code, 0));
+    else r << change_char (s (start, i));
+  }
+  return r;
+}
+
 string
 uni_locase_first (string s) {
   if (N (s) == 0) return s;
@@ -337,43 +458,19 @@ uni_upcase_first (string s) {
 
 string
 uni_locase_all (string s) {
-  string r;
-  int    i= 0, n= N (s);
-  while (i < n) {
-    int start= i;
-    tm_char_forwards (s, i);
-    r << uni_locase_char (s (start, i));
-  }
-  return r;
+  return uni_change_case (s, 0, locase_codes, locase_bytes, uni_locase_char);
 }
 
 string
 uni_Locase_all (string s) {
-  string r;
-  int    i= 0, n= N (s);
-  if (i < n) {
-    int start= i;
-    tm_char_forwards (s, i);
-    r << s (start, i);
-  }
-  while (i < n) {
-    int start= i;
-    tm_char_forwards (s, i);
-    r << uni_locase_char (s (start, i));
-  }
-  return r;
+  int i= 0;
+  tm_char_forwards (s, i);
+  return uni_change_case (s, i, locase_codes, locase_bytes, uni_locase_char);
 }
 
 string
 uni_upcase_all (string s) {
-  string r;
-  int    i= 0, n= N (s);
-  while (i < n) {
-    int start= i;
-    tm_char_forwards (s, i);
-    r << uni_upcase_char (s (start, i));
-  }
-  return r;
+  return uni_change_case (s, 0, upcase_codes, upcase_bytes, uni_upcase_char);
 }
 
 /******************************************************************************
@@ -383,6 +480,37 @@ uni_upcase_all (string s) {
 static array<string>           accented_list;
 static hashmap<string, string> unaccent_table;
 static hashmap<string, string> get_accent_table;
+static char                    unaccent_bytes[256]; // 0 if unchanged
+static int                     unaccent_byte_values[256]; // 1 + index, or 0
+static code_table              unaccent_codes;
+static array<string>           unaccent_values;
+static bool                    unaccent_named= false;
+
+// <#...> as spelled by to_Hex, without leading zeros or lower case digits
+static bool
+uni_is_hex_spelling (string& s, int start, int end) {
+  if (s[start + 2] == '0') return false;
+  for (int i= start + 2; i < end - 1; i++)
+    if (s[i] >= 'a' && s[i] <= 'f') return false;
+  return true;
+}
+
+static void
+unaccent_set (string c, string v) {
+  accented_list << c;
+  unaccent_table (c)= v;
+  int code= uni_decode_hex (c, 0, N (c));
+  if (N (c) == 1 && N (v) == 1) unaccent_bytes[(unsigned char) c[0]]= v[0];
+  else if (N (c) == 1) {
+    unaccent_byte_values[(unsigned char) c[0]]= N (unaccent_values) + 1;
+    unaccent_values << v;
+  }
+  else if (code >= 0 && uni_is_hex_spelling (c, 0, N (c))) {
+    code_table_set (unaccent_codes, code, N (unaccent_values), -1);
+    unaccent_values << v;
+  }
+  else unaccent_named= true;
+}
 
 static void
 fill (array<int> a, int start, int kind) {
@@ -391,8 +519,7 @@ fill (array<int> a, int start, int kind) {
       int    code= start + i;
       string c   = utf8_to_cork (encode_as_utf8 (code));
       string v   = utf8_to_cork (encode_as_utf8 (a[i]));
-      if (kind == 0) accented_list << c;
-      if (kind == 0) unaccent_table (c)= v;
+      if (kind == 0) unaccent_set (c, v);
       else get_accent_table (c)= v;
     }
 }
@@ -405,8 +532,7 @@ fill_bis (array<int> a, int start, int kind) {
       string c;
       c << ((unsigned char) code);
       string v= utf8_to_cork (encode_as_utf8 (a[i]));
-      if (kind == 0) accented_list << c;
-      if (kind == 0) unaccent_table (c)= v;
+      if (kind == 0) unaccent_set (c, v);
       else get_accent_table (c)= v;
     }
 }
@@ -463,11 +589,25 @@ uni_unaccent_all (string s) {
   string r;
   int    i= 0, n= N (s);
   while (i < n) {
+    if (s[i] != '<') {
+      unsigned char b= s[i];
+      if (unaccent_bytes[b] != 0) r << unaccent_bytes[b];
+      else if (unaccent_byte_values[b] != 0)
+        r << unaccent_values[unaccent_byte_values[b] - 1];
+      else r << s[i];
+      i++;
+      continue;
+    }
     int start= i;
     tm_char_forwards (s, i);
-    string c= s (start, i);
-    if (unaccent_table->contains (c)) r << unaccent_table[c];
-    else r << c;
+    // the table of strings is only needed for named symbols
+    int  code= uni_decode_hex (s, start, i);
+    bool hex = code >= 0 && uni_is_hex_spelling (s, start, i);
+    int  k   = hex ? code_table_get (unaccent_codes, code, -1) : -1;
+    if (k >= 0) r << unaccent_values[k];
+    else if (!hex && unaccent_named && unaccent_table->contains (s (start, i)))
+      r << unaccent_table[s (start, i)];
+    else r << s (start, i);
   }
   return r;
 }
@@ -13,6 +13,7 @@
 #include "converter.hpp"
 #include "cork.hpp"
 #include "locale.hpp"
+#include "simd_ascii.hpp"
 
 #include <lolly/data/unicode.hpp>
 
@@ -38,8 +39,11 @@ looks_ascii (unsigned char c) {
 bool
 looks_ascii (string s) {
   int i= 0, n= N (s);
-  for (; i < n; i++) {
+  while (i < n) {
+    i+= printable_ascii_prefix (&s[i], n - i);
+    if (i >= n) break;
     if (!looks_ascii (s[i])) return false;
+    i++;
   }
   return true;
 }
@@ -47,12 +51,16 @@ looks_ascii (string s) {
 static bool
 looks_utf8 (string s, bool bom) {
   int i= 0, n= N (s);
-  for (; i < n; i++) {
+  while (i < n) {
+    i+= printable_ascii_prefix (&s[i], n - i);
+    if (i >= n) break;
     unsigned char c= s[i];
-    if (looks_ascii (c)) continue;
+    if (looks_ascii (c)) {
+      i++;
+      continue;
+    }
     if (!bom && is_control_char (c)) return false;
     unsigned int code= decode_from_utf8 (s, i);
-    i--;
     if (code == c && !(is_control_char (c) && bom)) {
       return false;
     }
@@ -129,6 +137,16 @@ western_to_cork (string s) {
   if (looks_universal (s)) return s;
   return tm_encode (s);
 }
+string
+western_charset (string s) {
+  string charset= guess_wencoding (s);
+  if (charset == "ASCII" || charset == "UTF-8" || charset == "UTF-8-BOM")
+    return "UTF-8";
+  if (charset == "ISO-8859")
+    return language_to_local_ISO_charset (get_locale_language ());
+  return "";
+}
+
 string
 western_to_utf8 (string s) {
   string charset= guess_wencoding (s);
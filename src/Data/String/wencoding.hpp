@@ -20,6 +20,7 @@ bool looks_iso_8859 (string s);
 bool looks_universal (string s);
 
 string guess_wencoding (string s);
+string western_charset (string s);
 string western_to_cork (string s);
 string western_to_utf8 (string s);
 
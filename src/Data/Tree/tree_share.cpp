@@ -0,0 +1,44 @@
+
+/******************************************************************************
+ * MODULE     : tree_share.cpp
+ * DESCRIPTION: sharing of identical subtrees in read-only documents
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include "tree_share.hpp"
+#include "hashmap.hpp"
+
+/******************************************************************************
+ * Hash-consing through an intern table
+ ******************************************************************************/
+
+// Returns the number of nodes of t, or -1 if t is too large to be shared.
+// Children are interned before their parent, so that the hashing and the
+// comparisons in the table never visit more than max_size nodes.
+static int
+share_subtrees (tree& t, hashmap<tree, tree>& table, int max_size) {
+  int size= 1;
+  if (is_compound (t)) {
+    int i, n= N (t);
+    for (i= 0; i < n; i++) {
+      int sub= share_subtrees (t[i], table, max_size);
+      if (sub < 0 || size < 0) size= -1;
+      else size+= sub;
+    }
+  }
+  if (size < 0 || size > max_size) return -1;
+  if (table->contains (t)) t= table[t];
+  else table (t)= t;
+  return size;
+}
+
+tree
+share_subtrees (tree t, int max_size) {
+  hashmap<tree, tree> table;
+  share_subtrees (t, table, max_size);
+  return t;
+}
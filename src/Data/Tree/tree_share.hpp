@@ -0,0 +1,23 @@
+
+/******************************************************************************
+ * MODULE     : tree_share.hpp
+ * DESCRIPTION: sharing of identical subtrees in read-only documents
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#ifndef TREE_SHARE_H
+#define TREE_SHARE_H
+#include "tree.hpp"
+
+#define TREE_SHARE_MAX 8
+
+// Replace all atoms and all compound subtrees with at most max_size nodes
+// by a single representative per equivalence class. The tree is modified
+// in place, so it should be freshly built and never edited afterwards:
+// modifying a shared subtree would modify all its occurrences.
+tree share_subtrees (tree t, int max_size= TREE_SHARE_MAX);
+#endif // defined TREE_SHARE_H
@@ -11,6 +11,7 @@
 
 #include "edit_typeset.hpp"
 #include "Bridge/impl_typesetter.hpp"
+#include "alloc_stats.hpp"
 #include "analyze.hpp"
 #include "convert.hpp"
 #include "converter.hpp"
@@ -1013,6 +1014,7 @@ edit_typeset_rep::typeset_sub (SI& x1, SI& y1, SI& x2, SI& y2) {
   // time_t t2= texmacs_time ();
   // if (t2 - t1 >= 10) cout << "typeset took " << t2-t1 << "ms\n";
   picture_cache_clean ();
+  alloc_sample ();
 }
 
 static void
@@ -10,6 +10,7 @@
  ******************************************************************************/
 
 #include "font.hpp"
+#include "alloc_stats.hpp"
 #include "Freetype/tt_file.hpp"
 #include "colors.hpp"
 #include "convert.hpp"
@@ -57,6 +58,7 @@ font_rep::font_rep (string s)
   rsup_correct = rsup_guessed_table ();
   above_correct= above_guessed_table ();
   below_correct= below_guessed_table ();
+  alloc_hook_new (ALLOC_FONT);
 }
 
 font_rep::font_rep (string s, font fn)
@@ -75,8 +77,11 @@ font_rep::font_rep (string s, font fn)
   above_correct= above_guessed_table ();
   below_correct= below_guessed_table ();
   copy_math_pars (fn);
+  alloc_hook_new (ALLOC_FONT);
 }
 
+font_rep::~font_rep () { alloc_hook_delete (ALLOC_FONT); }
+
 void
 font_rep::copy_math_pars (font fn) {
   y1          = fn->y1;
@@ -100,6 +100,7 @@ struct font_rep : rep<font> {
 
   font_rep (string name);
   font_rep (string name, font fn);
+  virtual ~font_rep ();
   void copy_math_pars (font fn);
 
   virtual bool supports (string c)               = 0;
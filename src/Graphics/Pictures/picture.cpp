@@ -186,6 +186,16 @@ picture_cache_clean () {
   picture_blacklist= hashmap<tree, int> ();
 }
 
+void
+picture_cache_statistics (long& nr, long& bytes) {
+  iterator<tree> it= iterate (picture_cache);
+  while (it->busy ()) {
+    picture pic= picture_cache[it->next ()];
+    nr++;
+    bytes+= 4 * ((long) pic->get_width ()) * ((long) pic->get_height ());
+  }
+}
+
 #ifdef QTTEXMACS
 void qt_clean_picture_cache ();
 #endif
@@ -87,6 +87,7 @@ void    picture_cache_reserve (url u, int w, int h, tree eff, int pixel);
 void    picture_cache_release (url u, int w, int h, tree eff, int pixel);
 void    picture_cache_clean ();
 void    picture_cache_reset ();
+void    picture_cache_statistics (long& nr, long& bytes);
 picture cached_load_picture (url u, int w, int h, tree eff, int pixel,
                              bool perma= true);
 string  picture_as_eps (picture pic, int dpi);
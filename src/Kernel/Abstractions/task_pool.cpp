@@ -0,0 +1,245 @@
+
+/******************************************************************************
+ * MODULE     : task_pool.cpp
+ * DESCRIPTION: work-stealing pool of threads for background computations
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include "task_pool.hpp"
+#include "config.h"
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef QTTEXMACS
+#include <QCoreApplication>
+#include <QMetaObject>
+#endif
+
+static thread_local task_rep*  task_current= nullptr;
+static thread_local task_pool* task_owner  = nullptr;
+static thread_local int        task_worker = -1;
+
+/******************************************************************************
+ * Tasks
+ ******************************************************************************/
+
+bool
+task_rep::is_ready () {
+  int s= status;
+  return s == TASK_DONE || s == TASK_CANCELLED;
+}
+
+void
+task_rep::finish (int new_status) {
+  std::function<void ()> k;
+  {
+    std::lock_guard<std::mutex> guard (lock);
+    status= new_status;
+    if (new_status == TASK_DONE) k= on_main;
+    on_main= nullptr;
+  }
+  finished.notify_all ();
+  if (k) task_post_main (k);
+}
+
+void
+task_rep::execute () {
+  int expected= TASK_PENDING;
+  if (!status.compare_exchange_strong (expected, TASK_RUNNING)) return;
+  task_rep* saved= task_current;
+  task_current   = this;
+  try {
+    compute ();
+  } catch (...) {
+    error= std::current_exception ();
+  }
+  task_current= saved;
+  finish (TASK_DONE);
+}
+
+void
+task_rep::cancel () {
+  cancelled   = true;
+  int expected= TASK_PENDING;
+  if (status.compare_exchange_strong (expected, TASK_CANCELLED))
+    finish (TASK_CANCELLED);
+}
+
+void
+task_rep::continue_on_main (std::function<void ()> k) {
+  {
+    std::lock_guard<std::mutex> guard (lock);
+    if (status == TASK_CANCELLED) return;
+    if (status != TASK_DONE) {
+      on_main= k;
+      return;
+    }
+  }
+  task_post_main (k);
+}
+
+bool
+task_cancelled () {
+  return task_current != nullptr && task_current->cancelled;
+}
+
+/******************************************************************************
+ * Continuations on the main thread
+ ******************************************************************************/
+
+static std::mutex                         main_lock;
+static std::deque<std::function<void ()>> main_queue;
+
+void
+task_post_main (std::function<void ()> f) {
+  {
+    std::lock_guard<std::mutex> guard (main_lock);
+    main_queue.push_back (f);
+  }
+#ifdef QTTEXMACS
+  QCoreApplication* app= QCoreApplication::instance ();
+  if (app != nullptr)
+    QMetaObject::invokeMethod (
+        app, [] () { task_run_main (); }, Qt::QueuedConnection);
+#endif
+}
+
+int
+task_run_main () {
+  int nr= 0;
+  while (true) {
+    std::function<void ()> f;
+    {
+      std::lock_guard<std::mutex> guard (main_lock);
+      if (main_queue.empty ()) return nr;
+      f= main_queue.front ();
+      main_queue.pop_front ();
+    }
+    f ();
+    nr++;
+  }
+}
+
+/******************************************************************************
+ * Scheduling
+ ******************************************************************************/
+
+task_pool::task_pool (int nr_threads) : pending (0), stopping (false) {
+  if (nr_threads < 1) nr_threads= 1;
+  for (int i= 0; i < nr_threads; i++)
+    local.push_back (std::unique_ptr<task_deque> (new task_deque ()));
+  for (int i= 0; i < nr_threads; i++)
+    threads.push_back (std::thread (&task_pool::work, this, i));
+}
+
+task_pool::~task_pool () {
+  int n= (int) local.size ();
+  while (pending > 0) {
+    std::shared_ptr<task_rep> t= pop (-1);
+    if (t) t->cancel ();
+    else break;
+  }
+  {
+    std::lock_guard<std::mutex> guard (idle_lock);
+    stopping= true;
+  }
+  idle.notify_all ();
+  for (int i= 0; i < n; i++)
+    threads[i].join ();
+}
+
+int
+task_pool::worker_index () {
+  return task_owner == this ? task_worker : -1;
+}
+
+void
+task_pool::push (std::shared_ptr<task_rep> t) {
+  int         self= worker_index ();
+  task_deque& d   = self >= 0 ? *local[self] : global;
+  {
+    std::lock_guard<std::mutex> guard (d.lock);
+    d.tasks.push_back (t);
+  }
+  pending++;
+  { std::lock_guard<std::mutex> guard (idle_lock); }
+  idle.notify_one ();
+}
+
+// Workers take their most recent own task first, which keeps the data of
+// nested tasks warm, and otherwise steal the oldest tasks of the others.
+std::shared_ptr<task_rep>
+task_pool::pop (int self) {
+  std::shared_ptr<task_rep> t;
+  if (self >= 0) {
+    std::lock_guard<std::mutex> guard (local[self]->lock);
+    if (!local[self]->tasks.empty ()) {
+      t= local[self]->tasks.back ();
+      local[self]->tasks.pop_back ();
+    }
+  }
+  if (!t) {
+    std::lock_guard<std::mutex> guard (global.lock);
+    if (!global.tasks.empty ()) {
+      t= global.tasks.front ();
+      global.tasks.pop_front ();
+    }
+  }
+  int n= (int) local.size ();
+  for (int i= 1; i <= n && !t; i++) {
+    task_deque&                 victim= *local[(self + i + n) % n];
+    std::lock_guard<std::mutex> guard (victim.lock);
+    if (!victim.tasks.empty ()) {
+      t= victim.tasks.front ();
+      victim.tasks.pop_front ();
+    }
+  }
+  if (t) pending--;
+  return t;
+}
+
+void
+task_pool::work (int self) {
+  task_owner = this;
+  task_worker= self;
+  while (true) {
+    std::shared_ptr<task_rep> t= pop (self);
+    if (t) {
+      t->execute ();
+      continue;
+    }
+    std::unique_lock<std::mutex> guard (idle_lock);
+    idle.wait (guard, [this] () { return stopping || pending > 0; });
+    if (stopping) return;
+  }
+}
+
+bool
+task_pool::run_one () {
+  std::shared_ptr<task_rep> t= pop (worker_index ());
+  if (!t) return false;
+  t->execute ();
+  return true;
+}
+
+void
+task_pool::wait (task_rep* t) {
+  while (!t->is_ready ()) {
+    if (run_one ()) continue;
+    std::unique_lock<std::mutex> guard (t->lock);
+    t->finished.wait_for (guard, std::chrono::milliseconds (1),
+                          [t] () { return t->is_ready (); });
+  }
+}
+
+task_pool&
+global_task_pool () {
+  static task_pool pool (
+      std::max (1, (int) std::thread::hardware_concurrency () - 1));
+  return pool;
+}
@@ -0,0 +1,193 @@
+
+/******************************************************************************
+ * MODULE     : task_pool.hpp
+ * DESCRIPTION: work-stealing pool of threads for background computations
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// NOTE: the kernel data (strings, trees, urls, ...) is reference counted
+// without atomic operations and allocated by a thread unsafe allocator.
+// Tasks should therefore only compute on plain C++ data; their results
+// can be converted into kernel data by continuations on the main thread.
+
+enum { TASK_PENDING, TASK_RUNNING, TASK_DONE, TASK_CANCELLED };
+
+/******************************************************************************
+ * Tasks
+ ******************************************************************************/
+
+class task_rep {
+public:
+  std::atomic<int>        status;    // one of the TASK_* constants
+  std::atomic<bool>       cancelled; // cancellation has been requested
+  std::mutex              lock;
+  std::condition_variable finished;
+  std::function<void ()>  on_main; // continuation, posted once done
+  std::exception_ptr      error;
+
+  inline task_rep () : status (TASK_PENDING), cancelled (false) {}
+  inline virtual ~task_rep () {}
+  virtual void compute ()= 0;
+
+  bool is_ready ();
+  void execute ();
+  void cancel ();
+  void continue_on_main (std::function<void ()> k);
+
+protected:
+  void finish (int new_status);
+};
+
+template <typename T> class task_value_rep : public task_rep {
+public:
+  std::function<T ()> fun;
+  T                   value;
+
+  inline task_value_rep (std::function<T ()> fun2) : fun (fun2), value () {}
+  inline void compute () { value= fun (); }
+};
+
+template <> class task_value_rep<void> : public task_rep {
+public:
+  std::function<void ()> fun;
+
+  inline task_value_rep (std::function<void ()> fun2) : fun (fun2) {}
+  inline void compute () { fun (); }
+};
+
+// Within a task, tells whether its cancellation has been requested
+bool task_cancelled ();
+
+// Run a function on the main thread, through the Qt event loop if any
+void task_post_main (std::function<void ()> f);
+// Run the posted functions now; returns their number
+int task_run_main ();
+
+/******************************************************************************
+ * The pool
+ ******************************************************************************/
+
+template <typename T> class task_future;
+
+class task_pool {
+  struct task_deque {
+    std::mutex                            lock;
+    std::deque<std::shared_ptr<task_rep>> tasks;
+  };
+
+  std::vector<std::unique_ptr<task_deque>> local; // one deque per worker
+  task_deque                               global; // submissions from outside
+  std::vector<std::thread>                 threads;
+  std::mutex                               idle_lock;
+  std::condition_variable                  idle;
+  std::atomic<int>                         pending;
+  bool                                     stopping;
+
+  int                       worker_index ();
+  void                      push (std::shared_ptr<task_rep> t);
+  std::shared_ptr<task_rep> pop (int self);
+  void                      work (int self);
+
+public:
+  task_pool (int nr_threads);
+  ~task_pool ();
+
+  inline int size () { return (int) threads.size (); }
+  bool       run_one ();
+  void       wait (task_rep* t);
+
+  template <typename F> task_future<decltype (std::declval<F> () ())>
+  spawn (F f) {
+    typedef decltype (f ()) T;
+    std::shared_ptr<task_value_rep<T>> t=
+        std::make_shared<task_value_rep<T>> (std::function<T ()> (f));
+    push (t);
+    return task_future<T> (t, this);
+  }
+};
+
+// The pool shared by the whole program, with one thread less than cores
+task_pool& global_task_pool ();
+
+/******************************************************************************
+ * Futures
+ ******************************************************************************/
+
+template <typename T> class task_future {
+  std::shared_ptr<task_value_rep<T>> rep;
+  task_pool*                         pool;
+
+public:
+  inline task_future (std::shared_ptr<task_value_rep<T>> rep2, task_pool* p)
+      : rep (rep2), pool (p) {}
+
+  inline bool is_ready () { return rep->is_ready (); }
+  inline bool is_cancelled () { return rep->cancelled; }
+  inline void cancel () { rep->cancel (); }
+
+  // Waits for the result, helping the pool meanwhile; tasks which were
+  // cancelled before they could start yield a default value
+  T
+  get () {
+    pool->wait (rep.get ());
+    if (rep->error) std::rethrow_exception (rep->error);
+    return rep->value;
+  }
+
+  // The continuation is skipped if the task fails or is cancelled
+  void
+  then_on_main (std::function<void (T)> k) {
+    std::shared_ptr<task_value_rep<T>> r= rep;
+    rep->continue_on_main ([r, k] () {
+      if (!r->cancelled && !r->error) k (r->value);
+    });
+  }
+};
+
+template <> class task_future<void> {
+  std::shared_ptr<task_value_rep<void>> rep;
+  task_pool*                            pool;
+
+public:
+  inline task_future (std::shared_ptr<task_value_rep<void>> rep2,
+                      task_pool*                            p)
+      : rep (rep2), pool (p) {}
+
+  inline bool is_ready () { return rep->is_ready (); }
+  inline bool is_cancelled () { return rep->cancelled; }
+  inline void cancel () { rep->cancel (); }
+
+  void
+  get () {
+    pool->wait (rep.get ());
+    if (rep->error) std::rethrow_exception (rep->error);
+  }
+
+  void
+  then_on_main (std::function<void ()> k) {
+    std::shared_ptr<task_value_rep<void>> r= rep;
+    rep->continue_on_main ([r, k] () {
+      if (!r->cancelled && !r->error) k ();
+    });
+  }
+};
+
+#endif // defined TASK_POOL_H
@@ -70,7 +70,7 @@ immediate_options (int argc, char** argv) {
     else if (s == "-delete-style-cache")
       remove (get_tm_cache_path () * url_wildcard ("__*"));
     else if (s == "-delete-font-cache") {
-      remove (get_tm_cache_path () * url ("font_cache.scm"));
+      cache_delete ("font_cache.scm");
       remove (get_tm_cache_path () * url ("fonts") * url_wildcard ("*"));
       remove (url ("$TEXMACS_HOME_PATH/fonts/error") * url_wildcard ("*"));
     }
@@ -12,7 +12,9 @@
 #include "Bibtex/bibtex.hpp"
 #include "convert.hpp"
 #include "converter.hpp"
+#include "data_cache.hpp"
 #include "file.hpp"
+#include "hashmap.hpp"
 #include "lolly/system/subprocess.hpp"
 #include "sys_utils.hpp"
 #include "tree_helper.hpp"
@@ -161,19 +163,99 @@ complete_bib_file (url& bib_file, tree bib_t) {
     }
 }
 
-tree
-bibtex_run (string bib, string style, url bib_file, tree bib_t) {
-  if (!bibtex_present ()) {
-    string msg= "Error: could not launch bibtex program";
-    if (bibtex_command == "bibtex") return msg;
-    else return msg * " (" * bibtex_command * ")";
+/******************************************************************************
+ * Persistent cache of the generated bibliographies
+ *******************************************************************************
+ * The .bbl file produced by bibtex only depends on the style, the list of
+ * citations and the contents of the .bib and .bst files. It is stored
+ * under a hash of these data, so that bibtex is only launched again when
+ * one of them changes, also across sessions. The trees obtained from the
+ * .bbl files are in addition kept in memory during a session.
+ ******************************************************************************/
+
+#define BIBTEX_CACHE_BYTES (16 << 20) // size of the cached .bbl files
+
+static hashmap<string, tree> bibtex_tree_cache ("");
+
+static url
+bibtex_cache () {
+  return cache_directory ("bibtex", BIBTEX_CACHE_BYTES);
+}
+
+static url
+bibtex_bst_file (string style, url bib_file) {
+  // the .bst file as bibtex finds it: first in its working directory,
+  // then next to the .bib file and in the directories of $BSTINPUTS
+  string bst= style * ".bst";
+  url    u  = url ("$TEXMACS_HOME_PATH/system/bib", bst);
+  if (exists (u)) return u;
+  if (exists (head (bib_file) * bst)) return head (bib_file) * bst;
+  array<string> dirs= tokenize (get_env ("BSTINPUTS"), ":");
+  for (int i= 0; i < N (dirs); i++)
+    if (N (dirs[i]) > 0 && exists (url_system (dirs[i]) * bst))
+      return url_system (dirs[i]) * bst;
+  return url_none ();
+}
+
+string
+bibtex_cache_key (string style, url bib_file, tree bib_t) {
+  // citations are hashed in their order, which matters for unsorted styles
+  unsigned long long h= CACHE_HASH_SEED;
+  cache_hash (h, bibtex_command * "\n" * style * "\n");
+  for (int i= 0; i < arity (bib_t); i++)
+    cache_hash (h, as_string (bib_t[i]) * "\n");
+  url bib_u= bib_file;
+  if (suffix (bib_file) != "bib") bib_u= glue (bib_file, ".bib");
+  string contents;
+  if (load_string (bib_u, contents, false)) return "";
+  cache_hash (h, contents);
+  // styles of the TeX distribution are only identified by their name
+  url bst_u= bibtex_bst_file (style, bib_file);
+  if (!is_none (bst_u) && !load_string (bst_u, contents, false))
+    cache_hash (h, contents);
+  return cache_hexdigest (h);
+}
+
+static void
+bibtex_report (string log, bool ok) {
+  if (!ok) {
+    bibtex_error << log << "\n";
+    return;
   }
-  complete_bib_file (bib_file, bib_t);
-  if (contain_space (style))
-    return "Error: bibtex disallows spaces in style name";
+  int pos= 0;
+  while (true) {
+    pos= search_forwards ("Warning--", pos, log);
+    if (pos < 0) break;
+    pos+= 9;
+    int end= pos;
+    while (end < N (log) && log[end] != '\n')
+      end++;
+    bibtex_warning << log (pos, end) << "\n";
+  }
+}
+
+static void
+bibtex_replay_log (string key) {
+  // only successful runs are cached, so the log only contains warnings
+  string log;
+  url    u= bibtex_cache () * (key * ".log");
+  if (exists (u) && !load_string (u, log, false)) bibtex_report (log, true);
+}
+
+url
+bibtex_bbl (string style, url bib_file, tree bib_t, string key) {
+  url temp_bbl ("$TEXMACS_HOME_PATH/system/bib/temp.bbl");
+  url temp_log ("$TEXMACS_HOME_PATH/system/bib/temp.log");
+  url cached= url_none ();
+  if (key != "") {
+    cached= bibtex_cache () * (key * ".bbl");
+    if (exists (cached)) {
+      bibtex_replay_log (key);
+      return cached;
+    }
+  }
+
   string bib_name= as_string (tail (bib_file));
-  if (contain_space (bib_name))
-    return "Error: bibtex disallows spaces in bibliography name";
   int    i;
   string bib_s= "\\bibstyle{" * style * "}\n";
   for (i= 0; i < arity (bib_t); i++)
@@ -185,7 +267,12 @@ bibtex_run (string bib, string style, url bib_file, tree bib_t) {
     bib_name= bib_name (0, N (bib_name) - 4);
   bib_s << "\\bibdata{" << bib_name << "}\n";
   save_string ("$TEXMACS_HOME_PATH/system/bib/temp.aux", bib_s);
+  // never cache the output of a previous run
+  if (exists (temp_bbl)) remove (temp_bbl);
+  if (exists (temp_log)) remove (temp_log);
 
+  bool   ok= false;
+  string log;
 #ifdef OS_WIN_LATER
   c_string directory (dir);
   RunBibtex (directory, "$TEXMACS_HOME_PATH/system/bib", "temp");
@@ -197,23 +284,47 @@ bibtex_run (string bib, string style, url bib_file, tree bib_t) {
   if (DEBUG_AUTO) {
     if (!(DEBUG_STD)) debug_shell << cmdln << "\n";
   }
-  string log;
-  if (lolly::system::check_stdout (cmdln, log)) bibtex_error << log << "\n";
-  else {
-    int pos= 0;
-    while (true) {
-      pos= search_forwards ("Warning--", pos, log);
-      if (pos < 0) break;
-      pos+= 9;
-      int end= pos;
-      while (end < N (log) && log[end] != '\n')
-        end++;
-      bibtex_warning << log (pos, end) << "\n";
-    }
-  }
+  // the output of bibtex is redirected to its log file
+  string out;
+  ok= !lolly::system::check_stdout (cmdln, out);
+  if (load_string (temp_log, log, false)) log= out;
+  bibtex_report (log, ok);
 #endif
 
-  return bibtex_load_bbl (bib, "$TEXMACS_HOME_PATH/system/bib/temp.bbl");
+  if (key != "" && ok && exists (temp_bbl)) {
+    copy (temp_bbl, cached);
+    save_string (bibtex_cache () * (key * ".log"), log, false);
+  }
+  return temp_bbl;
+}
+
+tree
+bibtex_run (string bib, string style, url bib_file, tree bib_t) {
+  if (!bibtex_present ()) {
+    string msg= "Error: could not launch bibtex program";
+    if (bibtex_command == "bibtex") return msg;
+    else return msg * " (" * bibtex_command * ")";
+  }
+  complete_bib_file (bib_file, bib_t);
+  if (contain_space (style))
+    return "Error: bibtex disallows spaces in style name";
+  string bib_name= as_string (tail (bib_file));
+  if (contain_space (bib_name))
+    return "Error: bibtex disallows spaces in bibliography name";
+
+  string key= bibtex_cache_key (style, bib_file, bib_t);
+  string mem= key * ":" * bib;
+  if (key != "" && bibtex_tree_cache->contains (mem)) {
+    bibtex_replay_log (key);
+    return copy (bibtex_tree_cache[mem]);
+  }
+  tree r= bibtex_load_bbl (bib, bibtex_bbl (style, bib_file, bib_t, key));
+  if (key != "" && !is_atomic (r)) {
+    if (N (bibtex_tree_cache) >= 64)
+      bibtex_tree_cache= hashmap<string, tree> ("");
+    bibtex_tree_cache (mem)= copy (r);
+  }
+  return r;
   /*
   string result;
   if (load_string ("$TEXMACS_HOME_PATH/system/bib/temp.bbl", result, false))
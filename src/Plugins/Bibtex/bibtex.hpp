@@ -22,6 +22,8 @@ string conservative_bib_export (tree oldt, string olds, tree newt);
 void set_bibtex_command (string cmd);
 bool bibtex_present ();
 tree bibtex_load_bbl (string bib, url bbl_file);
+string bibtex_cache_key (string style, url bib_file, tree bib_t);
+url  bibtex_bbl (string style, url bib_file, tree bib_t, string key);
 tree bibtex_run (string bib, string style, url bib_file, tree bib_t);
 tree bibtex_run (string bib, string style, url bib_file, array<string> names);
 
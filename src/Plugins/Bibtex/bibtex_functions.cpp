@@ -26,56 +26,41 @@ using moebius::data::tree_to_scheme_tree;
  * Helper functions
  ******************************************************************************/
 
-static string
-bib_parse_char (string s, int& pos, int& depth, bool& special, int& math) {
+static void
+bib_skip_char (string s, int& pos, int& depth, bool& special, int& math) {
   switch (s[pos]) {
   case '{': {
     pos++;
     if (pos < N (s) && s[pos] == '\\' && depth == 0) special= true;
     depth++;
-    return "{";
+    return;
   }
   case '}': {
     pos++;
     depth--;
     if (special && depth == 0) special= false;
-    return "}";
+    return;
   }
   case '\\': {
-    string r= "\\";
     pos++;
-    if (pos < N (s) && (s[pos] == '{' || s[pos] == '}')) {
-      r << s[pos];
-      pos++;
-    }
+    if (pos < N (s) && (s[pos] == '{' || s[pos] == '}')) pos++;
     else /* if (special) */ {
-      if (pos < N (s) && !is_alpha (s[pos]) && !is_digit (s[pos])) {
-        r << s[pos];
-        pos++;
-      }
-      else {
-        while (pos < N (s) && (is_alpha (s[pos]) || is_digit (s[pos]))) {
-          r << s[pos];
+      if (pos < N (s) && !is_alpha (s[pos]) && !is_digit (s[pos])) pos++;
+      else
+        while (pos < N (s) && (is_alpha (s[pos]) || is_digit (s[pos])))
           pos++;
-        }
-      }
-      if (pos < N (s) && (is_alpha (s[pos]) || is_digit (s[pos]))) {
-        r << s[pos];
-        pos++;
-      }
+      if (pos < N (s) && (is_alpha (s[pos]) || is_digit (s[pos]))) pos++;
       else if (pos < N (s) && s[pos] == '{') {
         int d= 1;
-        r << s[pos];
         pos++;
         while (pos < N (s) && d > 0) {
           if (s[pos] == '{') d++;
           if (s[pos] == '}') d--;
-          r << s[pos];
           pos++;
         }
       }
     }
-    return r;
+    return;
   }
   case '$': {
     pos++;
@@ -83,23 +68,26 @@ bib_parse_char (string s, int& pos, int& depth, bool& special, int& math) {
       if (math == 2) math= 0;
       else math= 2;
       pos++;
-      return "$$";
     }
     else {
       if (math == 1) math= 0;
       else math= 1;
-      return "$";
     }
+    return;
   }
-  default: {
-    string r;
-    r << s[pos];
+  default:
     pos++;
-    return r;
-  }
   }
 }
 
+static string
+bib_parse_char (string s, int& pos, int& depth, bool& special, int& math) {
+  // the characters of a token are contiguous in s
+  int start= pos;
+  bib_skip_char (s, pos, depth, special, math);
+  return s (start, pos);
+}
+
 static string
 bib_get_char (string s, int pos) {
   int  d = 0;
@@ -110,19 +98,13 @@ bib_get_char (string s, int pos) {
 }
 
 static bool
-bib_is_normal (string s) {
-  return (N (s) == 1) && (s[0] != '{') && (s[0] != '}') && (s[0] != '\\') &&
-         !is_space (s[0]);
-}
-
-static bool
-bib_is_space (string s) {
-  return (N (s) == 1) && is_space (s[0]);
+bib_is_normal (char c) {
+  return (c != '{') && (c != '}') && (c != '\\') && !is_space (c);
 }
 
 static bool
-bib_keepcase_sep (string s) {
-  return (N (s) == 1) && (is_space (s[0]) || s[0] == '[' || s[0] == ']');
+bib_keepcase_sep (char c) {
+  return is_space (c) || c == '[' || c == ']';
 }
 
 /*
@@ -137,12 +119,7 @@ bib_is_digit (string s) {
 }
 */
 
-static bool
-bib_is_char (string s, char c) {
-  return (N (s) == 1) && (s[0] == c);
-}
-
-static string
+string
 bib_to_latex (string s) {
   string r         = "{";
   int    pos       = 0;
@@ -153,33 +130,34 @@ bib_to_latex (string s) {
   int    keepcase  = -1;
   while (pos < N (s)) {
     specialsav= special;
-    string ch = bib_parse_char (s, pos, depth, special, math);
-    // convert_warning << ch << " " << as_string (keepcase) << " " << as_string
-    // (depth) << "\n";
-    if (ch == "$$") r << "$";
-    else if (special || math) r << ch;
-    else if (bib_keepcase_sep (ch)) {
-      if (bib_is_space (ch)) ch= " ";
-      if (ch == "[" || ch == "]") ch= "{" * ch * "}";
+    int start = pos;
+    bib_skip_char (s, pos, depth, special, math);
+    bool one= (pos == start + 1);
+    char c  = s[start];
+    if (pos == start + 2 && c == '$' && s[start + 1] == '$') r << "$";
+    else if (special || math) r << s (start, pos);
+    else if (one && bib_keepcase_sep (c)) {
+      string ch= " ";
+      if (c == '[') ch= "{[}";
+      if (c == ']') ch= "{]}";
       if (keepcase == depth + 1) {
         r << "}" << ch;
         keepcase= -1;
       }
       else r << ch;
     }
-    else if (ch == "%") r << "\\%";
-    else if (bib_is_char (ch, '{') && depth > 0 &&
-             bib_get_char (s, pos) != "\\") {
+    else if (one && c == '%') r << "\\%";
+    else if (one && c == '{' && depth > 0 && bib_get_char (s, pos) != "\\") {
       if (keepcase == -1) {
         r << "\\keepcase{";
         keepcase= depth;
       }
       else if (keepcase < depth) r << "{";
     }
-    else if (bib_is_char (ch, '}')) {
-      if (keepcase <= depth || specialsav) r << ch;
+    else if (one && c == '}') {
+      if (keepcase <= depth || specialsav) r << c;
     }
-    else r << ch;
+    else r << s (start, pos);
   }
   for (int i= keepcase; i > 0; i--)
     r << "}";
@@ -190,6 +168,48 @@ bib_to_latex (string s) {
   return r;
 }
 
+/******************************************************************************
+ * Memoization of the converted fields
+ ******************************************************************************/
+
+// The styles query the same entries and fields many times while computing
+// labels, sort keys and the formatted entries; the conversions are shared.
+// The memoized trees must never be modified in place.
+
+#define BIB_MEMO_SIZE 4096
+
+static hashmap<scheme_tree, tree>   bib_tree_memo (UNINIT);
+static hashmap<scheme_tree, string> bib_purify_memo ("");
+static scheme_tree                  bib_entry_key (UNINIT);
+static tree                         bib_entry_value (UNINIT);
+
+void
+bib_reset_memos () {
+  bib_tree_memo  = hashmap<scheme_tree, tree> (UNINIT);
+  bib_purify_memo= hashmap<scheme_tree, string> ("");
+  bib_entry_key  = UNINIT;
+  bib_entry_value= UNINIT;
+}
+
+static tree
+bib_simplified (scheme_tree st) {
+  if (bib_tree_memo->contains (st)) return bib_tree_memo[st];
+  if (N (bib_tree_memo) >= BIB_MEMO_SIZE)
+    bib_tree_memo= hashmap<scheme_tree, tree> (UNINIT);
+  tree t= simplify_correct (scheme_tree_to_tree (st));
+  bib_tree_memo (st)= t;
+  return t;
+}
+
+static tree
+bib_entry_tree (scheme_tree st) {
+  if (st != bib_entry_key) {
+    bib_entry_key  = st;
+    bib_entry_value= scheme_tree_to_tree (st);
+  }
+  return bib_entry_value;
+}
+
 /******************************************************************************
  * BibTeX add.period$
  ******************************************************************************/
@@ -371,18 +391,18 @@ bib_default_upcase_first (scheme_tree st) {
  * BibTeX num.names$
  ******************************************************************************/
 
-static bool
+bool
 search_and_keyword (string s, int& pos) {
   int  depth  = 0;
   bool special= false;
   int  math   = 0;
   while (pos < N (s)) {
-    string ch= bib_parse_char (s, pos, depth, special, math);
-    if (bib_is_space (ch) && depth == 0) {
+    int start= pos;
+    bib_skip_char (s, pos, depth, special, math);
+    if (pos == start + 1 && is_space (s[start]) && depth == 0) {
       while (pos < N (s) && is_space (s[pos]))
         pos++;
-      if (pos < N (s) - 3 && s (pos, pos + 3) == "and" &&
-          is_space (s[pos + 3])) {
+      if (pos < N (s) - 3 && test (s, pos, "and") && is_space (s[pos + 3])) {
         pos+= 4;
         return true;
       }
@@ -470,27 +490,27 @@ bib_assoc (tree entry, string key) {
  * BibTeX format.name$ - only returns first, von, jr and last
  ******************************************************************************/
 
-static list<string>
+list<string>
 get_words (string s) {
   list<string> words;
-  string       curr;
   int          pos    = 0;
   int          depth  = 0;
   bool         special= false;
   int          math   = 0;
   while (pos < N (s) && is_space (s[pos]))
     pos++;
+  int word= pos;
   while (pos < N (s)) {
-    string ch= bib_parse_char (s, pos, depth, special, math);
-    if (bib_is_space (ch) && depth == 0) {
+    int start= pos;
+    bib_skip_char (s, pos, depth, special, math);
+    if (pos == start + 1 && is_space (s[start]) && depth == 0) {
       while (pos < N (s) && is_space (s[pos]))
         pos++;
-      curr >> words;
-      curr= "";
+      s (word, start) >> words;
+      word= pos;
     }
-    else curr << ch;
   }
-  if (curr != "") curr >> words;
+  if (word < N (s)) s (word, N (s)) >> words;
   return words;
 }
 
@@ -503,9 +523,10 @@ first_is_locase (string s) {
   while (pos < N (s) && is_space (s[pos]))
     pos++;
   while (pos < N (s)) {
-    string ch= bib_parse_char (s, pos, depth, special, math);
-    if (bib_is_normal (ch))
-      return (special || depth == 0) && is_iso_locase (ch[0]);
+    int start= pos;
+    bib_skip_char (s, pos, depth, special, math);
+    if (pos == start + 1 && bib_is_normal (s[start]))
+      return (special || depth == 0) && is_iso_locase (s[start]);
   }
   return false;
 }
@@ -589,27 +610,29 @@ get_vl_j_f (string svl, string sj, string sf) {
   return res;
 }
 
-static string
-get_until_char (string s, int& pos, string c) {
-  string res;
-  int    depth  = 0;
-  bool   special= false;
-  int    math   = 0;
+string
+get_until_char (string s, int& pos, char c) {
+  int  begin  = pos;
+  int  depth  = 0;
+  bool special= false;
+  int  math   = 0;
   while (pos < N (s)) {
-    string ch= bib_parse_char (s, pos, depth, special, math);
-    if (ch == c && depth == 0 && !special && math == 0) return res;
-    else res << ch;
+    int start= pos;
+    bib_skip_char (s, pos, depth, special, math);
+    if (pos == start + 1 && s[start] == c && c != '\0' && depth == 0 &&
+        !special && math == 0)
+      return s (begin, start);
   }
-  return res;
+  return s (begin, pos);
 }
 
 static string
 get_first_von_last (string s) {
   string a, b, c;
   int    pos= 0;
-  a         = get_until_char (s, pos, ",");
-  b         = get_until_char (s, pos, ",");
-  c         = get_until_char (s, pos, "");
+  a         = get_until_char (s, pos, ',');
+  b         = get_until_char (s, pos, ',');
+  c         = get_until_char (s, pos, '\0');
   if (a != "" && b == "" && c == "") {
     string res= get_fvl (a);
     res << "\\nextbib{}";
@@ -662,9 +685,12 @@ bib_purify_tree (tree t, string& res) {
 
 string
 bib_purify (scheme_tree st) {
-  tree   t= simplify_correct (scheme_tree_to_tree (st));
+  if (bib_purify_memo->contains (st)) return bib_purify_memo[st];
   string res;
-  bib_purify_tree (t, res);
+  bib_purify_tree (bib_simplified (st), res);
+  if (N (bib_purify_memo) >= BIB_MEMO_SIZE)
+    bib_purify_memo= hashmap<scheme_tree, string> ("");
+  bib_purify_memo (st)= res;
   return res;
 }
 
@@ -722,8 +748,7 @@ bib_tree_length (tree t) {
 
 int
 bib_text_length (scheme_tree st) {
-  tree t= simplify_correct (scheme_tree_to_tree (st));
-  return bib_tree_length (t);
+  return bib_tree_length (bib_simplified (st));
 }
 
 /******************************************************************************
@@ -755,7 +780,7 @@ bib_get_prefix (tree t, string& pre, int& i) {
 
 string
 bib_prefix (scheme_tree st, int i) {
-  tree t= simplify_correct (scheme_tree_to_tree (st));
+  tree t= bib_simplified (st);
   if (t == "others") return "+";
   string pre;
   int    j= i;
@@ -831,9 +856,9 @@ get_first_letters (tree t, tree s1, tree s2, tree& l) {
 
 scheme_tree
 bib_abbreviate (scheme_tree st, scheme_tree s1, scheme_tree s2) {
-  tree t  = simplify_correct (scheme_tree_to_tree (st));
-  tree ts1= simplify_correct (scheme_tree_to_tree (s1));
-  tree ts2= simplify_correct (scheme_tree_to_tree (s2));
+  tree t  = bib_simplified (st);
+  tree ts1= bib_simplified (s1);
+  tree ts2= bib_simplified (s2);
   tree l (CONCAT);
   get_first_letters (t, ts1, ts2, l);
   return tree_to_scheme_tree (l);
@@ -993,7 +1018,7 @@ bib_parse_fields (tree& t) {
 
 scheme_tree
 bib_field (scheme_tree st, string field) {
-  tree t= scheme_tree_to_tree (st);
+  tree t= bib_entry_tree (st);
   if (bib_is_entry (t)) {
     tree doc= t[2];
     for (int i= 0; i < N (doc); i++) {
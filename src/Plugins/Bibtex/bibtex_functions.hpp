@@ -17,6 +17,14 @@
 // string bib_change_case (string s, string op);
 // string bib_field_raw (scheme_tree t, string field);
 string bib_preamble (tree t);
+string bib_names (string s, int& nbfields);
+void   bib_reset_memos ();
+
+// scanners of names and fields, used by bib_names
+string       bib_to_latex (string s);
+bool         search_and_keyword (string s, int& pos);
+list<string> get_words (string s);
+string       get_until_char (string s, int& pos, char c);
 
 string       bib_purify (scheme_tree st);
 string       bib_prefix (scheme_tree st, int i);
@@ -12,7 +12,6 @@
 #include "analyze.hpp"
 #include "convert.hpp"
 #include "converter.hpp"
-#include "iterator.hpp"
 #include "preferences.hpp"
 #include "scheme.hpp"
 #include "tree_helper.hpp"
@@ -292,46 +291,6 @@ conservative_bib_import (string old_s, tree old_t, string new_s) {
  * Conservative TeXmacs -> BibTeX exportation
  ******************************************************************************/
 
-string
-conservative_bib_export (string src_s, tree src_t, string obj_s, tree obj_t) {
-  if (get_preference ("texmacs->bibtex:conservative", "off") != "on")
-    return obj_s;
-  // cout << "Conservative export\n";
-  if (src_t == obj_t) return src_s;
-  array<string>         src_a= bib_break (src_s);
-  array<string>         obj_a= bib_break (obj_s);
-  hashmap<string, int>  src_i= bib_indices (src_a);
-  hashmap<string, tree> src_e= bib_collect_entries (src_t);
-  hashmap<string, tree> obj_e= bib_collect_entries (obj_t);
-  int                   i, n= N (obj_a);
-  string                r         = copy (src_a[0]);
-  int                   prev_match= -3;
-  for (i= 1; i < n; i+= 2) {
-    string key= bib_get_key (obj_a[i]);
-    if (src_e->contains (key) && obj_e->contains (key) &&
-        bib_equivalent (src_e[key], obj_e[key])) {
-      int this_match= src_i[key];
-      if (i == 1)
-        ;
-      else if (this_match == prev_match + 2) r << copy (src_a[this_match - 1]);
-      else r << "\n";
-      if (this_match >= 0) r << copy (src_a[this_match]);
-      else r << copy (obj_a[i]);
-      prev_match= this_match;
-      // cout << "Matched " << i << ", " << this_match << "\n";
-    }
-    else {
-      if (i != 1) r << "\n";
-      r << copy (obj_a[i]);
-      prev_match= -1;
-    }
-  }
-  // cout << "Lengths " << N(src_a) << ", " << N(obj_a) << "\n";
-  if (N (src_a) > 1) r << copy (src_a[N (src_a) - 1]);
-  // if (r == src_s) cout << "Unaltered\n";
-  return r;
-}
-
 static string
 bib_export (tree t) {
   return as_string (call ("zealous-bib-export", t));
@@ -347,30 +306,47 @@ conservative_bib_export (tree old_t, string old_s, tree new_t) {
   array<string>         old_a= bib_break (old_s);
   hashmap<string, int>  old_i= bib_indices (old_a);
   hashmap<string, tree> old_e= bib_collect_entries (old_t);
-  hashmap<string, tree> new_e= bib_collect_entries (new_t);
   if (!bib_check_standard_preamble (old_a)) return bib_export (new_t);
 
-  tree             delta_t (DOCUMENT);
-  iterator<string> it= iterate (new_e);
-  while (it->busy ()) {
-    string key= it->next ();
-    tree   val= new_e[key];
-    if (!old_e->contains (key) || old_e[key] != val || !old_i->contains (key))
-      delta_t << val;
-  }
-  string               delta_s= bib_export (delta_t);
-  array<string>        delta_a= bib_break (delta_s);
-  hashmap<string, int> delta_i= bib_indices (delta_a);
-  // cout << "============== delta_s ================\n";
-  // cout << delta_s;
-  // cout << "=======================================\n";
-
-  string new_s;
+  // find the entries which changed and only export those again
+  tree          delta_t (DOCUMENT);
+  array<string> keys;
+  array<int>    match;
+  array<bool>   changed;
   for (int i= 0; i < N (new_t); i++)
     if (is_db_entry (new_t[i])) {
-      string key= cork_to_utf8 (new_t[i][2]->label);
-      if (delta_i->contains (key)) new_s << "\n" << delta_a[delta_i[key]];
-      else if (old_i->contains (key)) new_s << "\n" << old_a[old_i[key]];
+      tree   val= new_t[i];
+      string id = val[2]->label;
+      string key= cork_to_utf8 (id);
+      int    j  = old_i[key];
+      bool   c  = j < 0 || !old_e->contains (id) ||
+               !bib_equivalent (old_e[id], val);
+      if (c) delta_t << val;
+      keys << key;
+      match << j;
+      changed << c;
     }
-  return conservative_bib_export (old_s, old_t, new_s, new_t);
+  array<string> delta_a;
+  if (N (delta_t) != 0) delta_a= bib_break (bib_export (delta_t));
+  hashmap<string, int> delta_i= bib_indices (delta_a);
+
+  // copy the unchanged entries and the text between entries which keep
+  // their relative positions verbatim; changed entries replace their span
+  string r    = copy (old_a[0]);
+  int    prev = -3;
+  bool   first= true;
+  for (int k= 0; k < N (keys); k++) {
+    int j= match[k];
+    if (changed[k] && !delta_i->contains (keys[k])) continue;
+    if (first)
+      ;
+    else if (j >= 0 && j == prev + 2) r << old_a[j - 1];
+    else r << "\n";
+    if (changed[k]) r << delta_a[delta_i[keys[k]]];
+    else r << old_a[j];
+    prev = j;
+    first= false;
+  }
+  if (N (old_a) > 1) r << old_a[N (old_a) - 1];
+  return r;
 }
@@ -25,12 +25,17 @@ using namespace moebius;
 static string bib_current_tag= "";
 
 bool
-bibtex_non_empty_comment (string s) {
-  for (int i= 0; i < N (s); i++)
+bibtex_non_empty_comment (string s, int start, int end) {
+  for (int i= start; i < end; i++)
     if (is_alpha (s[i]) || is_numeric (s[i])) return true;
   return false;
 }
 
+bool
+bibtex_non_empty_comment (string s) {
+  return bibtex_non_empty_comment (s, 0, N (s));
+}
+
 bool
 bib_ok (string s, int pos) {
   return 0 <= pos && pos < N (s);
@@ -76,19 +81,28 @@ bib_open (string s, int& pos, char& cend) {
   }
 }
 
+/******************************************************************************
+ * The scanning routines below only move pos over the input and delimit
+ * spans of it; strings are only created for the resulting keys, names and
+ * field contents, as single substrings of the input.
+ ******************************************************************************/
+
+bool
+bib_is_in (char c, const char* cs) {
+  for (int i= 0; cs[i] != '\0'; i++)
+    if (cs[i] == c) return true;
+  return false;
+}
+
 bool
-bib_is_in (char c, string cs) {
-  int i= 0;
-  while (i < N (cs) && cs[i] != c)
-    i++;
-  return i != N (cs);
+bib_is_in (char c, const char* cs, const char* ce) {
+  return bib_is_in (c, cs) || bib_is_in (c, ce);
 }
 
 void
 bib_blank (string s, int& pos) {
-  if (!bib_ok (s, pos)) return;
-  string cs= " \t\n\r";
-  while (bib_ok (s, pos) && bib_is_in (s[pos], cs))
+  while (bib_ok (s, pos) && (s[pos] == ' ' || s[pos] == '\t' ||
+                             s[pos] == '\n' || s[pos] == '\r'))
     pos++;
 }
 
@@ -97,51 +111,51 @@ bib_within (string s, int& pos, char cbegin, char cend, string& content) {
   if (!bib_ok (s, pos)) return;
   int depth= 0;
   if (bib_char (s, pos, cbegin)) return;
+  int start= pos;
   while (bib_ok (s, pos) && (s[pos] != cend || depth > 0)) {
     if (cbegin != cend) {
       if (s[pos] == cbegin) depth++;
       else if (s[pos] == cend) depth--;
     }
-    if (s[pos] == '\\' && bib_ok (s, pos + 1)) {
-      content << '\\';
-      pos++;
-    }
-    content << s[pos];
+    if (s[pos] == '\\' && bib_ok (s, pos + 1)) pos++;
     pos++;
   }
+  content << s (start, min (pos, N (s)));
   bib_char (s, pos, cend);
 }
 
 void
-bib_until (string s, int& pos, string cs, string& content) {
+bib_until (string s, int& pos, const char* cs, const char* ce,
+           string& content) {
   if (!bib_ok (s, pos)) return;
-  while (bib_ok (s, pos) && !bib_is_in (s[pos], cs)) {
-    content << s[pos];
+  int start= pos;
+  while (bib_ok (s, pos) && !bib_is_in (s[pos], cs, ce))
     pos++;
-  }
+  content << s (start, pos);
+}
+
+void
+bib_until (string s, int& pos, const char* cs, string& content) {
+  bib_until (s, pos, cs, "", content);
 }
 
 void
 bib_comment (string s, int& pos, tree& t) {
   if (!bib_ok (s, pos)) return;
-  string content;
   while (bib_ok (s, pos) && s[pos] == '%') {
     bib_char (s, pos, '%');
-    while (bib_ok (s, pos) && s[pos] != '\n') {
-      content << s[pos];
+    int start= pos;
+    while (bib_ok (s, pos) && s[pos] != '\n')
       pos++;
-    }
-    t << compound ("bib-line", content);
-    content= "";
+    t << compound ("bib-line", s (start, min (pos, N (s))));
     pos++;
   }
 }
 
 void
-bib_atomic_arg (string s, int& pos, string ce, tree& a) {
+bib_atomic_arg (string s, int& pos, const char* ce, tree& a) {
   if (!bib_ok (s, pos)) return;
   string sa;
-  string f, v, j, l;
   switch (s[pos]) {
   case '\"': {
     bib_within (s, pos, '\"', '\"', sa);
@@ -154,14 +168,12 @@ bib_atomic_arg (string s, int& pos, string ce, tree& a) {
     break;
   }
   default: {
-    string cs= ", \t\n\r";
-    cs << ce;
     if (!is_digit (s[pos])) {
-      bib_until (s, pos, cs, sa);
+      bib_until (s, pos, ", \t\n\r", ce, sa);
       a= compound ("bib-var", western_to_cork (sa));
     }
     else {
-      bib_until (s, pos, cs, sa);
+      bib_until (s, pos, ", \t\n\r", ce, sa);
       a= western_to_cork (sa);
     }
     break;
@@ -170,11 +182,9 @@ bib_atomic_arg (string s, int& pos, string ce, tree& a) {
 }
 
 void
-bib_arg (string s, int& pos, string ce, tree& arg) {
+bib_arg (string s, int& pos, const char* ce, tree& arg) {
   if (!bib_ok (s, pos)) return;
-  string cs= ",";
-  cs << ce;
-  while (bib_ok (s, pos) && !bib_is_in (s[pos], cs)) {
+  while (bib_ok (s, pos) && !bib_is_in (s[pos], ",", ce)) {
     tree a;
     bib_atomic_arg (s, pos, ce, a);
     arg << a;
@@ -191,6 +201,7 @@ tree
 normalize_newlines (tree t) {
   if (is_atomic (t)) {
     string s= t->label, r;
+    if (search_forwards ("\n", 0, s) < 0) return t;
     for (int i= 0; i < N (s);)
       if (s[i] == '\n') {
         r << " ";
@@ -211,7 +222,7 @@ normalize_newlines (tree t) {
 }
 
 void
-bib_fields (string s, int& pos, string ce, string tag, tree& fields) {
+bib_fields (string s, int& pos, const char* ce, string tag, tree& fields) {
   if (!bib_ok (s, pos)) return;
   int savpos;
   bib_blank (s, pos);
@@ -223,7 +234,7 @@ bib_fields (string s, int& pos, string ce, string tag, tree& fields) {
     savpos= pos;
     string param;
     tree   arg (CONCAT);
-    bib_until (s, pos, string ("={( \t\n\r"), param);
+    bib_until (s, pos, "={( \t\n\r", param);
     if (bib_ok (s, pos) && (s[pos] == '{' || s[pos] == '(')) {
       pos= savpos;
       return;
@@ -237,9 +248,7 @@ bib_fields (string s, int& pos, string ce, string tag, tree& fields) {
     arg= normalize_newlines (arg);
     fields << compound (tag, param, arg);
     bib_blank (s, pos);
-    string cend= ce;
-    cend << ",";
-    while (bib_ok (s, pos) && !bib_is_in (s[pos], cend))
+    while (bib_ok (s, pos) && !bib_is_in (s[pos], ce, ","))
       pos++;
     while (bib_ok (s, pos) && s[pos] == ',') {
       pos++;
@@ -251,15 +260,12 @@ bib_fields (string s, int& pos, string ce, string tag, tree& fields) {
 void
 bib_string (string s, int& pos, tree& t) {
   if (!bib_ok (s, pos)) return;
-  tree   fields= tree (DOCUMENT);
-  string cs    = ", \t\n\r";
-  char   cend;
+  tree fields= tree (DOCUMENT);
+  char cend;
   if (bib_open (s, pos, cend)) return;
   pos++;
-  cs << cend;
   bib_blank (s, pos);
-  string ce;
-  ce << cend;
+  char ce[2]= {cend, '\0'};
   bib_fields (s, pos, ce, string ("bib-assign"), fields);
   bib_blank (s, pos);
   bib_char (s, pos, cend);
@@ -269,11 +275,10 @@ bib_string (string s, int& pos, tree& t) {
 void
 bib_preamble (string s, int& pos, tree& t) {
   if (!bib_ok (s, pos)) return;
-  string cs= ",";
-  char   cend;
+  char cend;
   if (bib_open (s, pos, cend)) return;
   pos++;
-  cs << cend;
+  char cs[3]= {',', cend, '\0'};
   bib_blank (s, pos);
   while (bib_ok (s, pos) && s[pos] == ',') {
     pos++;
@@ -298,20 +303,18 @@ bib_preamble (string s, int& pos, tree& t) {
 void
 bib_entry (string s, int& pos, tree type, tree& t) {
   if (!bib_ok (s, pos)) return;
-  tree   entry;
-  tree   fields= tree (DOCUMENT);
-  string cs    = ",\t\n\r";
-  char   cend;
+  tree entry;
+  tree fields= tree (DOCUMENT);
+  char cend;
   if (bib_open (s, pos, cend)) return;
   pos++;
-  cs << cend;
+  char cs[6]= {',', '\t', '\n', '\r', cend, '\0'};
   bib_blank (s, pos);
   string tag;
   bib_until (s, pos, cs, tag);
-  bib_current_tag= copy (tag);
+  bib_current_tag= tag;
   bib_blank (s, pos);
-  string ce;
-  ce << cend;
+  char ce[2]= {cend, '\0'};
   bib_fields (s, pos, ce, string ("bib-field"), fields);
   bib_blank (s, pos);
   bib_char (s, pos, cend);
@@ -347,12 +350,12 @@ bib_list (string s, int& pos, tree& t) {
       bib_blank (s, pos);
       savpos= pos;
       type  = "";
-      bib_until (s, pos, string ("{(= \t\n\r"), type);
+      bib_until (s, pos, "{(= \t\n\r", type);
       bib_blank (s, pos);
       if (bib_ok (s, pos) && s[pos] == '=') {
         tree fields (DOCUMENT);
         pos= savpos;
-        bib_fields (s, pos, string (")}@"), string ("bib-field"), tentry);
+        bib_fields (s, pos, ")}@", string ("bib-field"), tentry);
         bib_blank (s, pos);
         if (bib_ok (s, pos) && (s[pos] == ')' || s[pos] == '}')) {
           if (N (tpreamble) != 0) t << compound ("bib-preamble", tpreamble);
@@ -393,7 +396,7 @@ bib_list (string s, int& pos, tree& t) {
           int start= pos;
           while (pos + 1 < N (s) && s[pos + 1] != '@')
             pos++;
-          if (bibtex_non_empty_comment (s (start, pos + 1))) {
+          if (bibtex_non_empty_comment (s, start, min (pos + 1, N (s)))) {
             string        ss   = western_to_cork (s (start, pos + 1));
             array<string> lines= tokenize (ss, "\n");
             tree          doc (DOCUMENT);
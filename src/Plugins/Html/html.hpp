@@ -13,11 +13,35 @@
 #define HTML_HPP
 
 #include "tree.hpp"
+#include "url.hpp"
+
+#include <stdio.h>
 
 tree parse_html (string s);
+tree parse_html_file (url u);
 tree clean_html (tree t);
 tree parse_plain_html (string s);
 
+/*** Streaming output ***/
+struct html_output {
+  FILE*  f;
+  string buf;
+  bool   pre;
+
+  html_output (url u);
+  ~html_output ();
+  inline bool is_open () { return f != NULL; }
+  void        emit (string s);
+  void        flush ();
+  bool        close ();
+  void        open_element (tree t);
+  void        close_element (string name);
+  void        write (tree t);
+};
+
+bool save_html (url u, tree t);
+tree html_split_pages (tree doc, string what);
+
 tree upgrade_mathml (tree t);
 tree retrieve_mathjax (int id);
 
@@ -0,0 +1,200 @@
+
+/******************************************************************************
+ * MODULE     : htmlout.cpp
+ * DESCRIPTION: streaming serialization of html trees into files
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include "html.hpp"
+
+#include "file.hpp"
+#include "hashset.hpp"
+#include "tree_helper.hpp"
+#include <moebius/data/scheme.hpp>
+
+#include <stdio.h>
+
+using moebius::data::scm_unquote;
+
+#define HTML_OUTPUT_CHUNK 65536
+
+/******************************************************************************
+ * Buffered output
+ ******************************************************************************/
+
+html_output::html_output (url u) : buf (), pre (false) {
+  c_string name (concretize (u));
+  f= fopen (name, "wb");
+}
+
+html_output::~html_output () { close (); }
+
+void
+html_output::flush () {
+  if (f != NULL && N (buf) != 0) fwrite (&buf[0], 1, N (buf), f);
+  buf= "";
+}
+
+void
+html_output::emit (string s) {
+  buf << s;
+  if (N (buf) >= HTML_OUTPUT_CHUNK) flush ();
+}
+
+bool
+html_output::close () {
+  if (f == NULL) return true;
+  flush ();
+  bool err= ferror (f) != 0;
+  fclose (f);
+  f= NULL;
+  return err;
+}
+
+/******************************************************************************
+ * Serialization, following the conventions of htmlout.scm
+ ******************************************************************************/
+
+static hashset<string> html_void_table;
+static hashset<string> html_big_all_table;
+static hashset<string> html_big_tag_table;
+
+static void
+html_init_tables () {
+  if (N (html_void_table) != 0) return;
+  const char* voids[]= {"area", "base", "br",     "col",   "embed",
+                        "hr",   "img",  "input",  "link",  "meta",
+                        "source", "track", "wbr"};
+  for (int i= 0; i < 13; i++)
+    html_void_table->insert (voids[i]);
+  // both the tag and the children are displayed in multi-line format
+  const char* all[]= {"html", "head", "style", "body",   "table", "tr",
+                      "ul",   "ol",   "dl",    "mtable", "mtr"};
+  for (int i= 0; i < 11; i++) {
+    html_big_all_table->insert (all[i]);
+    html_big_tag_table->insert (all[i]);
+  }
+  // only the tag is displayed in multi-line format
+  const char* tag[]= {"div", "p", "li", "dt", "dd", "center", "blockquote"};
+  for (int i= 0; i < 7; i++)
+    html_big_tag_table->insert (tag[i]);
+}
+
+static string
+html_atom (tree t) {
+  string s= t->label;
+  if (is_quoted (s)) return scm_unquote (s);
+  return s;
+}
+
+static bool
+html_is_block (tree t) {
+  if (!is_tuple (t) || N (t) == 0 || !is_atomic (t[0])) return false;
+  string s= t[0]->label;
+  return s == "div" || s == "p" || s == "li" || s == "dt" || s == "dd" ||
+         s == "center" || s == "blockquote" || s == "ul" || s == "ol" ||
+         s == "dl";
+}
+
+void
+html_output::open_element (tree t) {
+  html_init_tables ();
+  string name = t[0]->label;
+  bool   attrs= N (t) > 1 && is_tuple (t[1], "@");
+  emit ("<" * name);
+  if (attrs) {
+    tree as= t[1];
+    for (int i= 1; i < N (as); i++) {
+      if (!is_tuple (as[i]) || N (as[i]) == 0) continue;
+      // later duplicates override earlier ones, as in htmlout.scm
+      bool dup= false;
+      for (int j= i + 1; j < N (as) && !dup; j++)
+        dup= is_tuple (as[j]) && N (as[j]) > 0 && as[j][0] == as[i][0];
+      if (dup) continue;
+      string val= N (as[i]) > 1 ? html_atom (as[i][1]) : string ("<implicit>");
+      if (val == "<implicit>") emit (" " * as[i][0]->label);
+      else emit (" " * as[i][0]->label * "=\"" * val * "\"");
+      if (as[i][0] == "xml:space") pre= (val == "preserve");
+    }
+  }
+  if (html_void_table->contains (name)) emit (" />");
+  else emit (">");
+  if (!pre && html_big_tag_table->contains (name)) emit ("\n");
+}
+
+void
+html_output::close_element (string name) {
+  html_init_tables ();
+  if (html_void_table->contains (name)) return;
+  if (!pre && html_big_tag_table->contains (name)) emit ("\n");
+  emit ("</" * name * ">");
+}
+
+void
+html_output::write (tree t) {
+  if (is_atomic (t)) emit (html_atom (t));
+  else if (N (t) == 0 || !is_atomic (t[0])) return;
+  else if (t[0] == "*TOP*" || t[0] == "!concat") {
+    for (int i= 1; i < N (t); i++)
+      write (t[i]);
+  }
+  else if (t[0] == "p" && N (t) == 2 && html_is_block (t[1])) write (t[1]);
+  else if (t[0] == "*PI*" && N (t) == 3)
+    emit ("<?" * t[1]->label * " " * html_atom (t[2]) * "?>\n");
+  else if (t[0] == "*DOCTYPE*") emit ("<!DOCTYPE html>\n");
+  else {
+    bool   saved= pre;
+    string name = t[0]->label;
+    open_element (t);
+    int  start= (N (t) > 1 && is_tuple (t[1], "@")) ? 2 : 1;
+    bool big  = html_big_all_table->contains (name);
+    // as htmlout-big? in htmlout.scm: block tags with block children
+    if (html_big_tag_table->contains (name))
+      for (int i= start; i < N (t) && !big; i++)
+        big= is_tuple (t[i]) && N (t[i]) > 0 && is_atomic (t[i][0]) &&
+             html_big_tag_table->contains (t[i][0]->label);
+    for (int i= start; i < N (t); i++) {
+      write (t[i]);
+      if (big && !pre && i + 1 < N (t)) emit ("\n");
+    }
+    close_element (name);
+    pre= saved;
+  }
+}
+
+/******************************************************************************
+ * Interface
+ ******************************************************************************/
+
+bool
+save_html (url u, tree t) {
+  html_output out (u);
+  if (!out.is_open ()) return true;
+  out.write (t);
+  return out.close ();
+}
+
+tree
+html_split_pages (tree doc, string what) {
+  tree r= tuple ();
+  if (!is_func (doc, DOCUMENT)) {
+    r << doc;
+    return r;
+  }
+  tree page (DOCUMENT);
+  for (int i= 0; i < N (doc); i++) {
+    tree t= doc[i];
+    bool cut= is_compound (t, what) || is_compound (t, what * "*");
+    if (cut && N (page) != 0) {
+      r << page;
+      page= tree (DOCUMENT);
+    }
+    page << t;
+  }
+  if (N (page) != 0 || N (r) == 0) r << page;
+  return r;
+}
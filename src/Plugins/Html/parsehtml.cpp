@@ -13,6 +13,7 @@
 
 #include "Xml/xml.hpp"
 #include "converter.hpp"
+#include "file.hpp"
 #include "hashset.hpp"
 #include "parse_string.hpp"
 
@@ -128,3 +129,19 @@ parse_html (string s) {
   if (contains_mathjax (s)) s= process_mathjax (s);
   return parse_plain_html (s);
 }
+
+tree
+parse_html_file (url u) {
+  // The whole file is needed in order to guess its charset and to detect
+  // MathJax, but the tree is built while streaming over the contents,
+  // instead of going through the token array of parse_plain_html
+  string s;
+  if (load_string (u, s, false)) return tuple ("*TOP*");
+  if (contains_mathjax (s)) return parse_html (s);
+  xml_html_parser helper;
+  helper.html= true;
+  s          = helper.transcode (s);
+  xml_tree_builder builder;
+  stream_xml (s, builder, true);
+  return builder.result ();
+}
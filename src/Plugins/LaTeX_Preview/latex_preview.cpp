@@ -14,13 +14,17 @@
 #include "Tex/convert_tex.hpp"
 #include "Tex/tex.hpp"
 #include "analyze.hpp"
+#include "data_cache.hpp"
 #include "file.hpp"
 #include "lolly/system/subprocess.hpp"
 #include "sys_utils.hpp"
 #include "tm_file.hpp"
 #include "tree_helper.hpp"
 
+#include <moebius/data/scheme.hpp>
+
 using namespace moebius;
+using moebius::data::tree_to_scheme;
 
 static inline void
 dbg (string s) {
@@ -40,6 +44,11 @@ latex_preview (string s, tree t) {
   dbg ("LaTeX preview disabled in WASM");
   return array<tree> ();
 }
+
+void
+set_latex_preview_compiler (latex_preview_compiler c) {
+  (void) c;
+}
 #else
 
 bool
@@ -47,9 +56,9 @@ latex_present () {
   return exists_in_path (latex_command);
 }
 
-array<string>
-search_latex_previews (tree t) {
-  array<string> r;
+static array<tree>
+search_latex_snippets (tree t) {
+  array<tree> r;
   if (is_atomic (t))
     ;
   else if (is_tuple (t, "\\def") || is_tuple (t, "\\def*") ||
@@ -57,15 +66,24 @@ search_latex_previews (tree t) {
            is_tuple (t, "\\newenvironment") ||
            is_tuple (t, "\\newenvironment*"))
     ;
-  else if (is_tuple (t, "\\latex_preview", 2)) r << as_string (t[1]);
+  else if (is_tuple (t, "\\latex_preview", 2)) r << t;
   else {
     int i, n= N (t);
     for (i= 0; i < n; i++)
-      r << search_latex_previews (t[i]);
+      r << search_latex_snippets (t[i]);
   }
   return r;
 }
 
+array<string>
+search_latex_previews (tree t) {
+  array<tree>   a= search_latex_snippets (t);
+  array<string> r;
+  for (int i= 0; i < N (a); i++)
+    r << as_string (a[i][1]);
+  return r;
+}
+
 void
 latex_clean_tmp_directory (url u) {
   bool          flag   = false;
@@ -194,8 +212,8 @@ latex_load_preview (url wdir, bool dvips= false) {
   return r;
 }
 
-array<tree>
-latex_preview (string s, tree t) {
+static array<tree>
+latex_compile_previews (string s, tree t) {
   if (!latex_present () && !exists_in_path ("latex")) {
     dbg ("LaTeX preview: " * latex_command * " not found");
     return array<tree> ();
@@ -234,17 +252,161 @@ latex_preview (string s, tree t) {
       return array<tree> ();
     }
   }
-  array<tree> r  = latex_load_preview (wdir, dvips);
-  int         exp= N (search_latex_previews (t));
-  if (N (r) != exp) {
+  array<tree> r= latex_load_preview (wdir, dvips);
+  latex_clean_tmp_directory (wdir);
+  return r;
+}
+
+static latex_preview_compiler the_compiler= latex_compile_previews;
+
+void
+set_latex_preview_compiler (latex_preview_compiler c) {
+  the_compiler= (c == NULL ? latex_compile_previews : c);
+}
+
+/******************************************************************************
+ * Persistent cache of the pictures
+ *******************************************************************************
+ * All pictures of a document are produced by a single LaTeX run, one page
+ * per preview. Each picture is stored under a hash of the preamble of the
+ * document, of its directory, of the files it includes and of the previewed
+ * snippet, so that only documents with new or modified snippets need to be
+ * compiled again.
+ ******************************************************************************/
+
+#define LATEX_PREVIEW_CACHE_BYTES (64 << 20) // size of the cached pictures
+
+static url
+latex_preview_cache () {
+  return cache_directory ("latex_preview", LATEX_PREVIEW_CACHE_BYTES);
+}
+
+static void
+hash_latex_definitions (unsigned long long& h, tree t) {
+  if (is_atomic (t))
+    ;
+  else if (is_tuple (t, "\\def") || is_tuple (t, "\\def*") ||
+           is_tuple (t, "\\def**") || is_tuple (t, "\\newenvironment**") ||
+           is_tuple (t, "\\newenvironment") ||
+           is_tuple (t, "\\newenvironment*"))
+    cache_hash (h, tree_to_scheme (t));
+  else
+    for (int i= 0; i < N (t); i++)
+      hash_latex_definitions (h, t[i]);
+}
+
+static void
+hash_latex_inclusions (unsigned long long& h, string s, url root) {
+  // LaTeX is run from the directory of the document, so the files which are
+  // included from there can change the pictures; they are identified by
+  // their modification times and sizes
+  static const char* cmds[]= {"\\input", "\\include", "\\includegraphics"};
+  static const char* exts[]= {"", ".tex", ".pdf", ".png", ".jpg", ".eps"};
+  for (int k= 0; k < 3; k++) {
+    string cmd= cmds[k];
+    int    pos= 0;
+    while ((pos= search_forwards (cmd, pos, s)) >= 0) {
+      int i= pos + N (cmd);
+      pos  = i;
+      if (i < N (s) && is_alpha (s[i])) continue;
+      while (i < N (s) && s[i] == ' ')
+        i++;
+      if (i < N (s) && s[i] == '[')
+        while (i < N (s) && s[i] != ']')
+          i++;
+      if (i < N (s) && s[i] == ']') i++;
+      if (i >= N (s) || s[i] != '{') continue;
+      int start= ++i;
+      while (i < N (s) && s[i] != '}')
+        i++;
+      string name= s (start, i);
+      url    u   = url_system (name);
+      if (is_rooted (u)) cache_hash (h, name);
+      else u= root * u;
+      cache_hash (h, cmd * "{" * name * "}");
+      for (int j= 0; j < 6; j++) {
+        url v= (j == 0 ? u : glue (u, exts[j]));
+        if (exists (v))
+          cache_hash (h, string (exts[j]) * ":" *
+                             as_string (last_modified (v, false)) * ":" *
+                             as_string (file_size (v)));
+      }
+    }
+  }
+}
+
+static array<string>
+latex_preview_keys (string s, tree t, array<tree> snippets) {
+  // Definitions in the body and included files may also change the pictures
+  unsigned long long h   = CACHE_HASH_SEED;
+  int                pos = latex_search_forwards ("\\begin{document}", 0, s);
+  url                root= head (get_file_focus ());
+  cache_hash (h, latex_command);
+  cache_hash (h, as_string (root));
+  cache_hash (h, pos < 0 ? s : s (0, pos));
+  hash_latex_definitions (h, t);
+  hash_latex_inclusions (h, s, root);
+  array<string> r;
+  for (int i= 0; i < N (snippets); i++) {
+    unsigned long long k= h;
+    cache_hash (k, tree_to_scheme (snippets[i]));
+    r << cache_hexdigest (k);
+  }
+  return r;
+}
+
+static bool
+latex_load_cached_preview (url dir, string key, tree& img) {
+  string s;
+  url    u= dir * (key * ".pic");
+  if (!exists (u) || load_string (u, s, false)) return false;
+  int i= search_forwards ("\n", s);
+  if (i < 0) return false;
+  array<string> sz= tokenize (s (0, i), " ");
+  if (N (sz) != 2) return false;
+  img= tree (IMAGE, tuple (tree (RAW_DATA, s (i + 1, N (s))), "eps"), sz[0],
+             sz[1], "", "");
+  return true;
+}
+
+static void
+latex_save_cached_preview (url dir, string key, tree img) {
+  if (!is_func (img, IMAGE, 5) || !is_func (img[0], TUPLE, 2) ||
+      !is_func (img[0][0], RAW_DATA, 1))
+    return;
+  string s= as_string (img[1]) * " " * as_string (img[2]) * "\n";
+  s << as_string (img[0][0][0]);
+  save_string (dir * (key * ".pic"), s, false);
+}
+
+array<tree>
+latex_preview (string s, tree t) {
+  array<tree>   snippets= search_latex_snippets (t);
+  array<string> keys    = latex_preview_keys (s, t, snippets);
+  url           dir     = latex_preview_cache ();
+  array<tree>   r;
+  for (int i= 0; i < N (keys); i++) {
+    tree img;
+    if (!latex_load_cached_preview (dir, keys[i], img)) break;
+    r << img;
+  }
+  if (N (r) == N (keys)) {
+    dbg ("LaTeX preview: all pictures found in cache");
+    return r;
+  }
+
+  r= the_compiler (s, t);
+  if (N (r) != N (keys)) {
     string msg;
     msg << "Warning: did not found the expected number of pictures:\n"
         << "         Got " << as_string (N (r)) << " whereas expected "
-        << as_string (exp) << ".\n         LaTeX compilation or picture"
+        << as_string (N (keys)) << ".\n         LaTeX compilation or picture"
         << " importation might have failed";
     dbg (msg);
   }
-  latex_clean_tmp_directory (wdir);
+  else
+    for (int i= 0; i < N (keys); i++)
+      latex_save_cached_preview (dir, keys[i], r[i]);
   return r;
 }
 #endif // OS_WASM
@@ -15,7 +15,10 @@
 #include "array.hpp"
 #include "tree.hpp"
 
+typedef array<tree> (*latex_preview_compiler) (string s, tree t);
+
 array<tree> latex_preview (string s, tree t);
 void        set_latex_command (string cmd);
+void        set_latex_preview_compiler (latex_preview_compiler c);
 
 #endif // LATEX_PREVIEW_H
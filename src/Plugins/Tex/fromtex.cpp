@@ -755,6 +755,342 @@ latex_fallback_on_pictures (string s, tree t) {
   return substitute_latex_previews (t, a, i);
 }
 
+/******************************************************************************
+ * Tables of symbols
+ *******************************************************************************
+ * The conversion of commands without arguments is done for every token, so
+ * the fixed translations are kept in static tables, sorted in ASCII order
+ * for binary search, instead of long chains of string comparisons.
+ ******************************************************************************/
+
+struct latex_symbol_entry {
+  const char* name;
+  const char* value;
+};
+
+struct latex_tagged_entry {
+  const char* name;
+  tree_label  label;
+  const char* value;
+};
+
+static const latex_symbol_entry latex_command_strings[]= {
+    {" ", " "},
+    {"*", "*"},
+    {"-", ""},
+    {"/", ""},
+    {"AA", "\xC5"},
+    {"AE", "\xC6"},
+    {"BlankLine", "\n"},
+    {"DH", "\xD0"},
+    {"L", "\x8A"},
+    {"MR", "MR "},
+    {"NG", "\x8D"},
+    {"O", "\xD8"},
+    {"OE", "\xD7"},
+    {"S", "\x9F"},
+    {"SS", "\xDF"},
+    {"TH", "\xDE"},
+    {"Vert", "<||>"},
+    {"aa", "\xE5"},
+    {"addots", "<udots>"},
+    {"ae", "\xE6"},
+    {"bgroup", ""},
+    {"bysame", "---"},
+    {"colon", ":"},
+    {"coloneqq", "<assign>"},
+    {"dh", "\xF0"},
+    {"dj", "\x9E"},
+    {"dots", "<ldots>"},
+    {"dotsb", "<cdots>"},
+    {"dotsc", "<ldots>"},
+    {"dotsi", "<cdots>"},
+    {"dotsm", "<cdots>"},
+    {"dotso", "<ldots>"},
+    {"egroup", ""},
+    {"gets", "<leftarrow>"},
+    {"hdashline", ""},
+    {"i", "\x19"},
+    {"iff", "<Longleftrightarrow>"},
+    {"implies", "<Longrightarrow>"},
+    {"infin", "<infty>"},
+    {"j", "\x1A"},
+    {"l", "\xAA"},
+    {"lVert", "<||>"},
+    {"limits", ""},   // tree (FORMAT, "with limits");
+    {"lq", "<#2018>"},
+    {"lvert", "|"},
+    {"ng", "\xAD"},
+    {"nolimits", ""}, // temporarily
+    {"notin", "<nin>"},
+    {"null", ""},
+    {"o", "\xF8"},
+    {"oe", "\xF7"},
+    {"par", "\n"},
+    {"pounds", "\xBF"},
+    {"protect", ""},
+    {"rVert", "<||>"},
+    {"rang", "<rangle>"},
+    {"rq", "<#2019>"},
+    {"rvert", "|"},
+    {"ss", "\xFF"},
+    {"th", "\xFE"},
+    {"unskip", ""},
+    {"vert", "|"},
+    {"|", "<||>"}
+};
+
+static const latex_tagged_entry latex_command_tags[]= {
+    {"!", SPACE, "-0.17em"},
+    {",", SPACE, "0.17em"},
+    {":", SPACE, "0.22em"},
+    {";", SPACE, "0.27em"},
+    {"BODY", BEGIN, "algo-body"},
+    {"ELSE", APPLY, "algo-else"},
+    {"ENDBODY", END, "algo-body"},
+    {"ENDFOR", END, "algo-for"},
+    {"ENDIF", END, "algo-if-else-if"},
+    {"ENDINPUTS", END, "algo-inputs"},
+    {"ENDLOOP", END, "algo-loop"},
+    {"ENDOUTPUTS", END, "algo-outputs"},
+    {"ENDWHILE", END, "algo-while"},
+    {"ENSURE", APPLY, "algo-ensure"},
+    {"Else", APPLY, "algo-else"},
+    {"EndFor", END, "algo-for"},
+    {"EndFunction", END, "algo-function"},
+    {"EndIf", END, "algo-if-else-if"},
+    {"EndLoop", END, "algo-loop"},
+    {"EndProcedure", END, "algo-procedure"},
+    {"EndWhile", END, "algo-while"},
+    {"Ensure", APPLY, "algo-ensure"},
+    {"FALSE", APPLY, "algo-false"},
+    {"GLOBALS", APPLY, "algo-globals"},
+    {"INPUTS", BEGIN, "algo-inputs"},
+    {"KwTo", APPLY, "algo-to"},
+    {"LOOP", BEGIN, "algo-loop"},
+    {"Loop", BEGIN, "algo-loop"},
+    {"OUTPUTS", BEGIN, "algo-outputs"},
+    {"P", APPLY, "paragraphsign"},
+    {"PRINT", APPLY, "algo-print"},
+    {"REPEAT", BEGIN, "algo-repeat"},
+    {"REQUIRE", APPLY, "algo-require"},
+    {"RETURN", APPLY, "algo-return"},
+    {"Repeat", BEGIN, "algo-repeat"},
+    {"Require", APPLY, "algo-require"},
+    {"STATE", APPLY, "algo-state"},
+    {"STMT", APPLY, "algo-state"},
+    {"State", APPLY, "algo-state"},
+    {"TO", APPLY, "algo-to"},
+    {"TRUE", APPLY, "algo-true"},
+    {"\\", FORMAT, "next line"},
+    {"bigskip", VSPACE, "2fn"},
+    {"bottomrule", APPLY, "hline"},
+    {"cleardoublepage", FORMAT, "new double page"},
+    {"clearpage", FORMAT, "new page"},
+    {"cr", FORMAT, "next line"},
+    {"enspace", SPACE, "0.5em"},
+    {"hfil", HTAB, "0pt"},
+    {"hfill", HTAB, "0pt"},
+    {"hfilll", HTAB, "0pt"},
+    {"hline", APPLY, "hline"},
+    {"hrulefill", APPLY, "hrule"},
+    {"linebreak", FORMAT, "line break"},
+    {"medskip", VSPACE, "1fn"},
+    {"midrule", APPLY, "hline"},
+    {"newdoublepage", FORMAT, "new double page"},
+    {"newline", FORMAT, "new line"},
+    {"newpage", FORMAT, "new page"},
+    {"nobreak", FORMAT, "no line break"},
+    {"noindent", FORMAT, "no first indentation"},
+    {"nolinebreak", FORMAT, "no line break"},
+    {"nopagebreak", FORMAT, "no page break after"},
+    {"pagebreak", FORMAT, "page break"},
+    {"qquad", SPACE, "2em"},
+    {"quad", SPACE, "1em"},
+    {"smallskip", VSPACE, "0.5fn"},
+    {"thinspace", SPACE, "0.17em"},
+    {"toprule", APPLY, "hline"}
+};
+
+static const latex_symbol_entry latex_symbol_strings[]= {
+    {"Arrowvert", "<||>"},
+    {"Upalpha", "<Alpha>"},
+    {"Upbeta", "<Beta>"},
+    {"Upchi", "<Chi>"},
+    {"Updelta", "<Delta>"},
+    {"Upepsilon", "<Epsilon>"},
+    {"Upeta", "<Eta>"},
+    {"Upgamma", "<Gamma>"},
+    {"Upiota", "<Iota>"},
+    {"Upkappa", "<Kappa>"},
+    {"Uplambda", "<Lambda>"},
+    {"Upmu", "<Mu>"},
+    {"Upnu", "<Nu>"},
+    {"Upomega", "<Omega>"},
+    {"Upomicron", "<Omicron>"},
+    {"Upphi", "<Phi>"},
+    {"Uppi", "<Pi>"},
+    {"Uppsi", "<Psi>"},
+    {"Uprho", "<Rho>"},
+    {"Upsigma", "<Sigma>"},
+    {"Uptau", "<Tau>"},
+    {"Uptheta", "<Theta>"},
+    {"Upupsilon", "<Upsilon>"},
+    {"Upzeta", "<Zeta>"},
+    {"arrowvert", "|"},
+    {"hdots", "<ldots>"},
+    {"land", "<wedge>"},
+    {"lbrace", "{"},
+    {"lbrack", "["},
+    {"lnot", "<neg>"},
+    {"lor", "<vee>"},
+    {"rbrace", "}"},
+    {"rbrack", "]"},
+    {"textbackslash", "\\"},
+    {"tmprecdot", "<precdot>"},
+    {"upalpha", "<up-alpha>"},
+    {"upbeta", "<up-beta>"},
+    {"upchi", "<up-chi>"},
+    {"updelta", "<up-delta>"},
+    {"upepsilon", "<up-epsilon>"},
+    {"upeta", "<up-eta>"},
+    {"upgamma", "<up-gamma>"},
+    {"upiota", "<up-iota>"},
+    {"upkappa", "<up-kappa>"},
+    {"uplambda", "<up-lambda>"},
+    {"upmu", "<up-mu>"},
+    {"upnu", "<up-nu>"},
+    {"upomega", "<up-omega>"},
+    {"upomicron", "<up-omicron>"},
+    {"upphi", "<up-phi>"},
+    {"uppi", "<up-pi>"},
+    {"uppsi", "<up-psi>"},
+    {"uprho", "<up-rho>"},
+    {"upsigma", "<up-sigma>"},
+    {"uptau", "<up-tau>"},
+    {"uptheta", "<up-theta>"},
+    {"upupsilon", "<up-upsilon>"},
+    {"upvarepsilon", "<up-varepsilon>"},
+    {"upvarphi", "<up-varphi>"},
+    {"upvarpi", "<up-varpi>"},
+    {"upvarrho", "<up-varrho>"},
+    {"upvarsigma", "<up-varsigma>"},
+    {"upvartheta", "<up-vartheta>"},
+    {"upzeta", "<up-zeta>"}
+};
+
+static const latex_symbol_entry latex_length_strings[]= {
+    {"@bls", "par-sep"},
+    {"@ixpt", "9"},
+    {"@viiipt", "8"},
+    {"@viipt", "7"},
+    {"@vipt", "6"},
+    {"@vpt", "5"},
+    {"@xiipt", "12"},
+    {"@xipt", "10.95"},
+    {"@xivpt", "14.4"},
+    {"@xpt", "10"},
+    {"@xviipt", "17.28"},
+    {"@xxpt", "20.74"},
+    {"@xxvpt", "24.88"},
+    {"abovedisplayshortskip", "tex-above-display-short-skip"},
+    {"abovedisplayskip", "tex-above-display-skip"},
+    {"belowdisplayshortskip", "tex-below-display-short-skip"},
+    {"belowdisplayskip", "tex-below-display-skip"},
+    {"bigskipamount", "2fn"},
+    {"columnsep", "tex-column-sep"},
+    {"columnwidth", "tex-column-width"},
+    {"evensidemargin", "tex-even-side-margin"},
+    {"footnotesep", "tex-footnote-sep"},
+    {"footskip", "tex-foot-skip"},
+    {"headheight", "tex-head-height"},
+    {"headsep", "tex-head-sep"},
+    {"jot", "tex-jot"},
+    {"linewidth", "tex-line-width"},
+    {"marginparwidth", "tex-margin-par-width"},
+    {"mathindent", "tex-math-indent"},
+    {"medskipamount", "1fn"},
+    {"oddsidemargin", "tex-odd-side-margin"},
+    {"p@", "pt"},
+    {"parindent", "par-first"},
+    {"smallskipamount", "0.5fn"},
+    {"textheight", "tex-text-height"},
+    {"textwidth", "tex-text-width"},
+    {"topmargin", "tex-top-margin"},
+    {"topskip", "tex-top-skip"},
+    {"z@", "0pt"}
+};
+
+static const latex_symbol_entry latex_name_strings[]= {
+    {"abstractname", "abstract-text"},
+    {"appendixname", "appendix-text"},
+    {"contentsname", "table-of-contents-text"},
+    {"figurename", "figure-text"},
+    {"indexname", "index-text"},
+    {"listfigurename", "list-of-figures-text"},
+    {"listtablename", "list-of-tables-text"},
+    {"partname", "part-text"},
+    {"refname", "bibliography-text"},
+    {"tablename", "table-text"}
+};
+
+static const latex_symbol_entry latex_environment_names[]= {
+    {"IEEEproof", "proof"},
+    {"acks", "acknowledgments"},
+    {"ans", "answer"},
+    {"ax", "axiom"},
+    {"center", "padded-center"},
+    {"conv", "convention"},
+    {"cor", "corollary"},
+    {"corr", "corollary"},
+    {"def", "definition"},
+    {"defn", "definition"},
+    {"dem", "proof"},
+    {"dfn", "definition"},
+    {"ex", "example"},
+    {"exa", "example"},
+    {"exc", "exercise"},
+    {"exe", "exercise"},
+    {"exo", "exercise"},
+    {"flushleft", "padded-left-aligned"},
+    {"flushright", "padded-right-aligned"},
+    {"lem", "lemma"},
+    {"not", "notation"},
+    {"pf", "proof"},
+    {"preuve", "proof"},
+    {"prob", "problem"},
+    {"prop", "proposition"},
+    {"rem", "remark"},
+    {"sol", "solution"},
+    {"th", "theorem"},
+    {"thm", "theorem"},
+    {"war", "warning"}
+};
+
+static int
+latex_symbol_compare (string s, const char* name) {
+  int i, n= N (s);
+  for (i= 0; i < n && name[i] != '\0'; i++)
+    if (s[i] != name[i])
+      return ((unsigned char) s[i]) < ((unsigned char) name[i]) ? -1 : 1;
+  if (i < n) return 1;
+  return name[i] == '\0' ? 0 : -1;
+}
+
+template <class T, int n>
+static int
+latex_symbol_search (string s, const T (&table)[n]) {
+  int lo= 0, hi= n;
+  while (lo < hi) {
+    int mid= (lo + hi) >> 1;
+    int c  = latex_symbol_compare (s, table[mid].name);
+    if (c == 0) return mid;
+    if (c < 0) hi= mid;
+    else lo= mid + 1;
+  }
+  return -1;
+}
+
 /******************************************************************************
  * Transform parsed tex/latex trees into texmacs trees
  ******************************************************************************/
@@ -779,240 +1115,44 @@ latex_symbol_to_tree (string s) {
       return "...";
     if (s == "\n") return tree (APPLY, "!emptyline");
     if (latex_type ('\\' * s) == "command") {
-      if (s == " ") return " ";
-      if (s == "-") return "";
-      if (s == "/") return "";
-      if (s == "lq") return "<#2018>";
-      if (s == "rq") return "<#2019>";
-      if (s == "AA") return "\xC5";
-      if (s == "AE") return "\xC6";
-      if (s == "DH") return "\xD0";
-      if (s == "L") return "\x8A";
-      if (s == "NG") return "\x8D";
-      if (s == "O") return "\xD8";
-      if (s == "OE") return "\xD7";
-      if (s == "S") return "\x9F";
-      if (s == "SS") return "\xDF";
-      if (s == "TH") return "\xDE";
-      if (s == "aa") return "\xE5";
-      if (s == "ae") return "\xE6";
-      if (s == "dh") return "\xF0";
-      if (s == "dj") return "\x9E";
-      if (s == "i") return "\x19";
-      if (s == "j") return "\x1A";
-      if (s == "l") return "\xAA";
-      if (s == "ng") return "\xAD";
-      if (s == "o") return "\xF8";
-      if (s == "oe") return "\xF7";
-      if (s == "ss") return "\xFF";
-      if (s == "th") return "\xFE";
-      if (s == "pounds") return "\xBF";
-      if (s == "BlankLine") return "\n";
-      if (s == "par") return "\n";
-      if (s == "P") return tree (APPLY, "paragraphsign");
-      ;
+      int k= latex_symbol_search (s, latex_command_strings);
+      if (k >= 0) return latex_command_strings[k].value;
+      k= latex_symbol_search (s, latex_command_tags);
+      if (k >= 0)
+        return tree (latex_command_tags[k].label, latex_command_tags[k].value);
       if (s == "AND") return concat (tree (APPLY, "algo-and"), " ");
       if (s == "NOT") return concat (tree (APPLY, "algo-not"), " ");
       if (s == "OR") return concat (tree (APPLY, "algo-or"), " ");
       if (s == "XOR") return concat (tree (APPLY, "algo-xor"), " ");
-      if (s == "ENSURE") return tree (APPLY, "algo-ensure");
-      if (s == "Ensure") return tree (APPLY, "algo-ensure");
-      if (s == "FALSE") return tree (APPLY, "algo-false");
-      if (s == "GLOBALS") return tree (APPLY, "algo-globals");
-      if (s == "PRINT") return tree (APPLY, "algo-print");
-      if (s == "REQUIRE") return tree (APPLY, "algo-require");
-      if (s == "Require") return tree (APPLY, "algo-require");
-      if (s == "RETURN") return tree (APPLY, "algo-return");
-      if (s == "STATE") return tree (APPLY, "algo-state");
-      if (s == "State") return tree (APPLY, "algo-state");
-      if (s == "STMT") return tree (APPLY, "algo-state");
-      if (s == "TO") return tree (APPLY, "algo-to");
-      if (s == "KwTo") return tree (APPLY, "algo-to");
-      if (s == "TRUE") return tree (APPLY, "algo-true");
-      if (s == "BODY") return tree (BEGIN, "algo-body");
-      if (s == "INPUTS") return tree (BEGIN, "algo-inputs");
-      if (s == "OUTPUTS") return tree (BEGIN, "algo-outputs");
-      if (s == "ELSE") return tree (APPLY, "algo-else");
-      if (s == "Else") return tree (APPLY, "algo-else");
-      if (s == "LOOP") return tree (BEGIN, "algo-loop");
-      if (s == "Loop") return tree (BEGIN, "algo-loop");
-      if (s == "REPEAT") return tree (BEGIN, "algo-repeat");
-      if (s == "Repeat") return tree (BEGIN, "algo-repeat");
-      if (s == "ENDBODY") return tree (END, "algo-body");
-      if (s == "EndFor") return tree (END, "algo-for");
-      if (s == "EndFunction") return tree (END, "algo-function");
-      if (s == "ENDFOR") return tree (END, "algo-for");
-      if (s == "ENDIF") return tree (END, "algo-if-else-if");
-      if (s == "EndIf") return tree (END, "algo-if-else-if");
-      if (s == "ENDINPUTS") return tree (END, "algo-inputs");
-      if (s == "ENDLOOP") return tree (END, "algo-loop");
-      if (s == "EndLoop") return tree (END, "algo-loop");
-      if (s == "ENDOUTPUTS") return tree (END, "algo-outputs");
-      if (s == "EndProcedure") return tree (END, "algo-procedure");
-      if (s == "ENDWHILE") return tree (END, "algo-while");
-      if (s == "EndWhile") return tree (END, "algo-while");
-      if (s == "\\") return tree (FORMAT, "next line");
-      if (s == "cr") return tree (FORMAT, "next line");
-      if (s == "noindent") return tree (FORMAT, "no first indentation");
-      if (s == "linebreak") return tree (FORMAT, "line break");
-      if (s == "newline") return tree (FORMAT, "new line");
-      if (s == "nobreak") return tree (FORMAT, "no line break");
-      if (s == "nolinebreak") return tree (FORMAT, "no line break");
-      if (s == "pagebreak") return tree (FORMAT, "page break");
-      if (s == "nopagebreak") return tree (FORMAT, "no page break after");
-      if (s == "newpage") return tree (FORMAT, "new page");
-      if (s == "newdoublepage") return tree (FORMAT, "new double page");
-      if (s == "clearpage") return tree (FORMAT, "new page");
-      if (s == "cleardoublepage") return tree (FORMAT, "new double page");
       if (s == "strut")
         return tree (APPLY, "resize", "", "0pt", "-0.3bls", "0pt", "0.7bls");
-      if (s == "!") return tree (SPACE, "-0.17em");
-      if (s == ",") return tree (SPACE, "0.17em");
-      if (s == "thinspace") return tree (SPACE, "0.17em");
-      if (s == ":") return tree (SPACE, "0.22em");
-      if (s == "enspace") return tree (SPACE, "0.5em");
-      if (s == ";") return tree (SPACE, "0.27em");
-      if (s == "quad") return tree (SPACE, "1em");
-      if (s == "qquad") return tree (SPACE, "2em");
-      if (s == "smallskip") return tree (VSPACE, "0.5fn");
-      if (s == "medskip") return tree (VSPACE, "1fn");
-      if (s == "bigskip") return tree (VSPACE, "2fn");
-      if (s == "hfil") return tree (HTAB, "0pt");
-      if (s == "hfill") return tree (HTAB, "0pt");
-      if (s == "hfilll") return tree (HTAB, "0pt");
-      if (s == "hline") return tree (APPLY, "hline");
-      if (s == "toprule") return tree (APPLY, "hline");
-      if (s == "midrule") return tree (APPLY, "hline");
-      if (s == "bottomrule") return tree (APPLY, "hline");
-      if (s == "hrulefill") return tree (APPLY, "hrule");
-      if (s == "hdashline") return "";
       if (s == "appendix") {
         textm_appendices= true;
         return "";
       }
-      if (s == "limits") return "";   // tree (FORMAT, "with limits");
-      if (s == "nolimits") return ""; // temporarily
-      if (s == "*") return "*";
-      if (s == "vert") return "|";
-      if (s == "|") return "<||>";
-      if (s == "Vert") return "<||>";
-      if (s == "notin") return "<nin>";
-      if (s == "addots") return "<udots>";
-      if (s == "dots") return "<ldots>";
-      if (s == "infin") return "<infty>";
-      if (s == "rang") return "<rangle>";
       if (s == "today") return compound ("date", "");
       if (s == "tableofcontents")
         return compound ("table-of-contents", "toc", tree (DOCUMENT, ""));
-      if (s == "null") return "";
-      if (s == "unskip") return "";
-      if (s == "protect") return "";
-      if (s == "bgroup") return "";
-      if (s == "egroup") return "";
-      if (s == "colon") return ":";
-      if (s == "coloneqq") return "<assign>";
-      if (s == "dotsc") return "<ldots>";
-      if (s == "dotsb") return "<cdots>";
-      if (s == "dotsm") return "<cdots>";
-      if (s == "dotsi") return "<cdots>";
-      if (s == "dotso") return "<ldots>";
-      if (s == "lvert") return "|";
-      if (s == "rvert") return "|";
-      if (s == "lVert") return "<||>";
-      if (s == "rVert") return "<||>";
       if (s == "qed") return compound ("math", "<Box>");
-      if (s == "implies") return "<Longrightarrow>";
-      if (s == "iff") return "<Longleftrightarrow>";
-      if (s == "gets") return "<leftarrow>";
       if (s == "printindex") return compound ("the-index", "idx", "");
       if (s == "twocolumn") return tree (SET, "par-columns", "2");
       if (s == "onecolumn") return tree (SET, "par-columns", "1");
-      if (s == "bysame") return "---";
-      if (s == "MR") return "MR ";
     }
 
-    if (latex_type (s) == "symbol") {
-      if (s == "lnot") return "<neg>";
-      if (s == "land") return "<wedge>";
-      if (s == "lor") return "<vee>";
-      if (s == "textbackslash") return "\\";
-      if (s == "hdots") return "<ldots>";
-      if (s == "arrowvert") return "|";
-      if (s == "Arrowvert") return "<||>";
-      if (s == "lbrack") return "[";
-      if (s == "rbrack") return "]";
-      if (s == "lbrace") return "{";
-      if (s == "rbrace") return "}";
-      if (s == "tmprecdot") return "<precdot>";
-
-      if (starts (s, "up")) {
-        if (s == "upalpha") return "<up-alpha>";
-        if (s == "upbeta") return "<up-beta>";
-        if (s == "upgamma") return "<up-gamma>";
-        if (s == "updelta") return "<up-delta>";
-        if (s == "upepsilon") return "<up-epsilon>";
-        if (s == "upvarepsilon") return "<up-varepsilon>";
-        if (s == "upzeta") return "<up-zeta>";
-        if (s == "upeta") return "<up-eta>";
-        if (s == "uptheta") return "<up-theta>";
-        if (s == "upvartheta") return "<up-vartheta>";
-        if (s == "upiota") return "<up-iota>";
-        if (s == "upkappa") return "<up-kappa>";
-        if (s == "uplambda") return "<up-lambda>";
-        if (s == "upmu") return "<up-mu>";
-        if (s == "upnu") return "<up-nu>";
-        if (s == "upomicron") return "<up-omicron>";
-        if (s == "uppi") return "<up-pi>";
-        if (s == "upvarpi") return "<up-varpi>";
-        if (s == "uprho") return "<up-rho>";
-        if (s == "upvarrho") return "<up-varrho>";
-        if (s == "upsigma") return "<up-sigma>";
-        if (s == "upvarsigma") return "<up-varsigma>";
-        if (s == "uptau") return "<up-tau>";
-        if (s == "upupsilon") return "<up-upsilon>";
-        if (s == "upphi") return "<up-phi>";
-        if (s == "upvarphi") return "<up-varphi>";
-        if (s == "upchi") return "<up-chi>";
-        if (s == "uppsi") return "<up-psi>";
-        if (s == "upomega") return "<up-omega>";
-      }
-
-      if (starts (s, "Up")) {
-        if (s == "Upalpha") return "<Alpha>";
-        if (s == "Upbeta") return "<Beta>";
-        if (s == "Upgamma") return "<Gamma>";
-        if (s == "Updelta") return "<Delta>";
-        if (s == "Upepsilon") return "<Epsilon>";
-        if (s == "Upzeta") return "<Zeta>";
-        if (s == "Upeta") return "<Eta>";
-        if (s == "Uptheta") return "<Theta>";
-        if (s == "Upiota") return "<Iota>";
-        if (s == "Upkappa") return "<Kappa>";
-        if (s == "Uplambda") return "<Lambda>";
-        if (s == "Upmu") return "<Mu>";
-        if (s == "Upnu") return "<Nu>";
-        if (s == "Upomicron") return "<Omicron>";
-        if (s == "Uppi") return "<Pi>";
-        if (s == "Uprho") return "<Rho>";
-        if (s == "Upsigma") return "<Sigma>";
-        if (s == "Uptau") return "<Tau>";
-        if (s == "Upupsilon") return "<Upsilon>";
-        if (s == "Upphi") return "<Phi>";
-        if (s == "Upchi") return "<Chi>";
-        if (s == "Uppsi") return "<Psi>";
-        if (s == "Upomega") return "<Omega>";
-      }
-
+    string type= latex_type (s);
+    if (type == "symbol") {
+      int k= latex_symbol_search (s, latex_symbol_strings);
+      if (k >= 0) return latex_symbol_strings[k].value;
       return "<" * s * ">";
     }
 
-    if (latex_type (s) == "texmacs") {
+    if (type == "texmacs") {
       if (s == "tmdummy") return "";
       if (s == "tmbsl") return "\\";
       if (s == "withTeXmacstext") return tree (COMPOUND, "with-TeXmacs-text");
     }
 
-    if ((latex_type (s) == "modifier") && (latex_arity (s) == 0)) {
+    if ((type == "modifier") && (latex_arity (s) == 0)) {
       if (s == "centering") return tree (SET, PAR_MODE, "center");
       if (s == "raggedright" || s == "flushleft")
         return tree (SET, PAR_MODE, "left");
@@ -1092,147 +1232,41 @@ latex_symbol_to_tree (string s) {
       TM_FAILED ("unexpected situation");
     }
 
-    if (latex_type (s) == "length") {
-      if (s == "@vpt") return "5";
-      if (s == "@vipt") return "6";
-      if (s == "@viipt") return "7";
-      if (s == "@viiipt") return "8";
-      if (s == "@ixpt") return "9";
-      if (s == "@xpt") return "10";
-      if (s == "@xipt") return "10.95";
-      if (s == "@xiipt") return "12";
-      if (s == "@xivpt") return "14.4";
-      if (s == "@xviipt") return "17.28";
-      if (s == "@xxpt") return "20.74";
-      if (s == "@xxvpt") return "24.88";
-
-      if (s == "@bls") return "par-sep";
-      if (s == "p@") return "pt";
-      if (s == "z@") return "0pt";
-
-      if (s == "abovedisplayshortskip") return "tex-above-display-short-skip";
-      if (s == "abovedisplayskip") return "tex-above-display-skip";
-      if (s == "belowdisplayshortskip") return "tex-below-display-short-skip";
-      if (s == "belowdisplayskip") return "tex-below-display-skip";
-      if (s == "columnsep") return "tex-column-sep";
-      if (s == "evensidemargin") return "tex-even-side-margin";
-      if (s == "footnotesep") return "tex-footnote-sep";
-      if (s == "footskip") return "tex-foot-skip";
-      if (s == "headheight") return "tex-head-height";
-      if (s == "headsep") return "tex-head-sep";
-      if (s == "jot") return "tex-jot";
-      if (s == "marginparwidth") return "tex-margin-par-width";
-      if (s == "mathindent") return "tex-math-indent";
-      if (s == "oddsidemargin") return "tex-odd-side-margin";
-      if (s == "parindent") return "par-first";
-      if (s == "textheight") return "tex-text-height";
-      if (s == "textwidth") return "tex-text-width";
-      if (s == "columnwidth") return "tex-column-width";
-      if (s == "linewidth") return "tex-line-width";
-      if (s == "topmargin") return "tex-top-margin";
-      if (s == "topskip") return "tex-top-skip";
-      if (s == "smallskipamount") return "0.5fn";
-      if (s == "medskipamount") return "1fn";
-      if (s == "bigskipamount") return "2fn";
+    if (type == "length") {
+      int k= latex_symbol_search (s, latex_length_strings);
+      if (k >= 0) return latex_length_strings[k].value;
     }
 
     // FIXME: avoid redefinition of command_type in parsetex.cpp
-    if (latex_type (s) == "name" || latex_type (s) == "user") {
-      if (s == "abstractname") return "abstract-text";
-      if (s == "appendixname") return "appendix-text";
-      if (s == "contentsname") return "table-of-contents-text";
-      if (s == "figurename") return "figure-text";
-      if (s == "indexname") return "index-text";
-      if (s == "listfigurename") return "list-of-figures-text";
-      if (s == "listtablename") return "list-of-tables-text";
-      if (s == "partname") return "part-text";
-      if (s == "refname") return "bibliography-text";
-      if (s == "tablename") return "table-text";
+    if (type == "name" || type == "user") {
+      int k= latex_symbol_search (s, latex_name_strings);
+      if (k >= 0) return latex_name_strings[k].value;
     }
 
-    if (latex_type (s) == "ignore") return "";
+    if (type == "ignore") return "";
 
-    if (latex_type (s) == "operator" || latex_type (s) == "control") return s;
+    if (type == "operator" || type == "control") return s;
     if (s == "bignone") return tree (BIG, ".");
     if (s == "Return") return tree (APPLY, "algo-return");
     if (s == "tmhrule") return tree (APPLY, "hrule");
     if (s == "og") return "\x13 "; // open guillemets (French)
     if (s == "fg") return "\x14";  // close guillemets (French)
-    if (latex_type (s) == "big-symbol") {
+    if (type == "big-symbol") {
       if (s (0, 3) == "big") return tree (BIG, s (3, N (s)));
       else return tree (BIG, s);
     }
 
     if ((N (s) > 6) && (s (0, 6) == "begin-")) {
-      if (s == "begin-center") return tree (BEGIN, "padded-center");
-      if (s == "begin-flushleft") return tree (BEGIN, "padded-left-aligned");
-      if (s == "begin-flushright") return tree (BEGIN, "padded-right-aligned");
-    }
-    if ((N (s) > 4) && (s (0, 4) == "end-")) {
-      if (s == "end-center") return tree (END, "padded-center");
-      if (s == "end-flushleft") return tree (END, "padded-left-aligned");
-      if (s == "end-flushright") return tree (END, "padded-right-aligned");
-    }
-
-    if ((N (s) > 6) && (s (0, 6) == "begin-")) {
-      if (s == "begin-th") return tree (BEGIN, "theorem");
-      if (s == "begin-thm") return tree (BEGIN, "theorem");
-      if (s == "begin-prop") return tree (BEGIN, "proposition");
-      if (s == "begin-lem") return tree (BEGIN, "lemma");
-      if (s == "begin-cor") return tree (BEGIN, "corollary");
-      if (s == "begin-corr") return tree (BEGIN, "corollary");
-      if (s == "begin-pf") return tree (BEGIN, "proof");
-      if (s == "begin-dem") return tree (BEGIN, "proof");
-      if (s == "begin-preuve") return tree (BEGIN, "proof");
-      if (s == "begin-IEEEproof") return tree (BEGIN, "proof");
-      if (s == "begin-ax") return tree (BEGIN, "axiom");
-      if (s == "begin-def") return tree (BEGIN, "definition");
-      if (s == "begin-dfn") return tree (BEGIN, "definition");
-      if (s == "begin-defn") return tree (BEGIN, "definition");
-      if (s == "begin-not") return tree (BEGIN, "notation");
-      if (s == "begin-ex") return tree (BEGIN, "example");
-      if (s == "begin-exa") return tree (BEGIN, "example");
-      if (s == "begin-rem") return tree (BEGIN, "remark");
-      if (s == "begin-war") return tree (BEGIN, "warning");
-      if (s == "begin-conv") return tree (BEGIN, "convention");
-      if (s == "begin-exe") return tree (BEGIN, "exercise");
-      if (s == "begin-exc") return tree (BEGIN, "exercise");
-      if (s == "begin-exo") return tree (BEGIN, "exercise");
-      if (s == "begin-prob") return tree (BEGIN, "problem");
-      if (s == "begin-sol") return tree (BEGIN, "solution");
-      if (s == "begin-ans") return tree (BEGIN, "answer");
-      if (s == "begin-acks") return tree (BEGIN, "acknowledgments");
-      return tree (BEGIN, s (6, N (s)));
+      string env= s (6, N (s));
+      int    k  = latex_symbol_search (env, latex_environment_names);
+      if (k >= 0) return tree (BEGIN, latex_environment_names[k].value);
+      return tree (BEGIN, env);
     }
     if ((N (s) > 4) && (s (0, 4) == "end-")) {
-      if (s == "end-th") return tree (END, "theorem");
-      if (s == "end-thm") return tree (END, "theorem");
-      if (s == "end-prop") return tree (END, "proposition");
-      if (s == "end-lem") return tree (END, "lemma");
-      if (s == "end-cor") return tree (END, "corollary");
-      if (s == "end-corr") return tree (END, "corollary");
-      if (s == "end-pf") return tree (END, "proof");
-      if (s == "end-dem") return tree (END, "proof");
-      if (s == "end-preuve") return tree (END, "proof");
-      if (s == "end-IEEEproof") return tree (END, "proof");
-      if (s == "end-ax") return tree (END, "axiom");
-      if (s == "end-def") return tree (END, "definition");
-      if (s == "end-dfn") return tree (END, "definition");
-      if (s == "end-defn") return tree (END, "definition");
-      if (s == "end-not") return tree (END, "notation");
-      if (s == "end-ex") return tree (END, "example");
-      if (s == "end-exa") return tree (END, "example");
-      if (s == "end-rem") return tree (END, "remark");
-      if (s == "end-war") return tree (END, "warning");
-      if (s == "end-conv") return tree (END, "convention");
-      if (s == "end-exe") return tree (END, "exercise");
-      if (s == "end-exc") return tree (END, "exercise");
-      if (s == "end-exo") return tree (END, "exercise");
-      if (s == "end-prob") return tree (END, "problem");
-      if (s == "end-sol") return tree (END, "solution");
-      if (s == "end-ans") return tree (END, "answer");
-      if (s == "end-acks") return tree (END, "acknowledgments");
-      return tree (END, s (4, N (s)));
+      string env= s (4, N (s));
+      int    k  = latex_symbol_search (env, latex_environment_names);
+      if (k >= 0) return tree (END, latex_environment_names[k].value);
+      return tree (END, env);
     }
 
     if (starts (s, "#") && s != "#") {
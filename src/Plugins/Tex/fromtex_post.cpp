@@ -1268,13 +1268,107 @@ make_paragraphs (tree t, tree r) {
   return r;
 }
 
+/******************************************************************************
+ * Registry of post-processing passes
+ *******************************************************************************
+ * Most passes rebuild the whole tree, even when it does not contain any of
+ * the constructs they rewrite. A pass may therefore declare the space
+ * separated keys which trigger it: tree labels like "with", or "begin:env"
+ * and "apply:cmd" for environments and commands which are not yet converted.
+ * The keys occurring in the tree are collected once for a sequence of passes,
+ * and a pass is skipped if none of its keys occur. This is only valid if
+ * no earlier pass of the same sequence introduces one of these keys.
+ * The skipping can be disabled in order to check that it does not alter
+ * the result of a conversion.
+ ******************************************************************************/
+
+static bool post_pass_skipping= true;
+
+void
+set_post_pass_skipping (bool on) {
+  post_pass_skipping= on;
+}
+
+struct post_pass {
+  const char* name;
+  tree (*rewrite) (tree);
+  const char* keys;  // empty if the pass must always be run
+};
+
+#define N_POST_PASSES(a) ((int) (sizeof (a) / sizeof (post_pass)))
+
+static void
+collect_post_keys (tree t, hashset<int>& labels, hashset<string>& keys) {
+  if (is_atomic (t)) return;
+  labels->insert ((int) L (t));
+  if ((is_func (t, BEGIN) || is_func (t, APPLY)) && N (t) > 0 &&
+      is_atomic (t[0]))
+    keys->insert ((is_func (t, BEGIN) ? "begin:" : "apply:") * t[0]->label);
+  for (int i= 0; i < N (t); i++)
+    collect_post_keys (t[i], labels, keys);
+}
+
+static hashmap<string, array<int>>    post_pass_labels;
+static hashmap<string, array<string>> post_pass_keys;
+
+static void
+parse_post_keys (string s) {
+  // split the declared keys once into tree labels and "begin:" or "apply:"
+  // keys, since make_tree_label is too expensive for each run of a pass
+  array<string> a= tokenize (s, " ");
+  array<int>    labels;
+  array<string> keys;
+  for (int i= 0; i < N (a); i++)
+    if (occurs (":", a[i])) keys << a[i];
+    else if (N (a[i]) > 0) labels << ((int) make_tree_label (a[i]));
+  post_pass_labels (s)= labels;
+  post_pass_keys (s)  = keys;
+}
+
+static bool
+triggers_post_pass (post_pass p, hashset<int> labels, hashset<string> keys) {
+  if (!post_pass_skipping || p.keys[0] == '\0') return true;
+  string s (p.keys);
+  if (!post_pass_labels->contains (s)) parse_post_keys (s);
+  array<int>    l= post_pass_labels[s];
+  array<string> k= post_pass_keys[s];
+  for (int i= 0; i < N (l); i++)
+    if (labels->contains (l[i])) return true;
+  for (int i= 0; i < N (k); i++)
+    if (keys->contains (k[i])) return true;
+  return false;
+}
+
+static tree
+run_post_passes (tree t, post_pass* passes, int n) {
+  hashset<int>    labels;
+  hashset<string> keys;
+  collect_post_keys (t, labels, keys);
+  for (int i= 0; i < n; i++)
+    if (triggers_post_pass (passes[i], labels, keys)) {
+      // cout << passes[i].name << "\n";
+      t= passes[i].rewrite (t);
+    }
+  return t;
+}
+
+static post_pass finalize_document_passes[]= {
+    {"Finalize algorithms", finalize_algorithms,
+     "begin:algorithm begin:algorithm* begin:algorithmic begin:algorithmic* "
+     "begin:algorithm2e begin:algorithm2e*"},
+    {"Finalize returns", finalize_returns, ""},
+    {"Finalize pmatrix", finalize_pmatrix,
+     "begin:array begin:array* begin:tabular begin:tabular* begin:tabularx "
+     "begin:tabularx* begin:cases begin:stack begin:matrix begin:pmatrix "
+     "begin:bmatrix begin:vmatrix begin:smallmatrix apply:matrix "
+     "apply:smallmatrix apply:substack"},
+    {"Finalize layout", finalize_layout, ""}};
+
 static tree
 finalize_document (tree t) {
   if (is_atomic (t)) t= tree (CONCAT, t);
-  t= finalize_algorithms (t);
-  t= finalize_returns (t);
-  t= finalize_pmatrix (t);
-  t= finalize_layout (t);
+  t= run_post_passes (t, finalize_document_passes,
+                      N_POST_PASSES (finalize_document_passes));
   if (!is_func (t, CONCAT)) return tree (DOCUMENT, t);
   t= make_paragraphs (t, tree (DOCUMENT));
   t= finalize_sections (t);
@@ -1921,12 +2015,15 @@ eat_space_around_control (tree t) {
 
 static tree
 downgrade_newlines (tree t) {
+  // Also removes the geometry, which is collected before finalize_textm
   if (is_atomic (t)) return t;
-  tree r (L (t), N (t));
+  tree r (L (t));
   for (int i= 0; i < N (t); i++) {
-    r[i]= downgrade_newlines (t[i]);
-    if (i > 0 && is_compound (t[i - 1], "!emptyline"))
-      if (is_func (t[i], NEW_LINE, 0)) r[i]= " ";
+    if (is_compound (t[i], "geometry")) continue;
+    if (i > 0 && is_compound (t[i - 1], "!emptyline") &&
+        is_func (t[i], NEW_LINE, 0))
+      r << " ";
+    else r << downgrade_newlines (t[i]);
   }
   return r;
 }
@@ -2150,18 +2247,6 @@ unnest_withs (tree t) {
   return r;
 }
 
-/****************************** Remove geometry ******************************/
-
-static tree
-remove_geometry (tree t) {
-  if (is_atomic (t)) return t;
-  int  i, n= N (t);
-  tree r (L (t));
-  for (i= 0; i < n; i++)
-    if (!is_compound (t[i], "geometry")) r << remove_geometry (t[i]);
-  return r;
-}
-
 /************************** Clean vertical spacing ***************************/
 
 static bool
@@ -2237,34 +2322,36 @@ clean_vspace (tree t) {
 
 /****************************** Finalize textm *******************************/
 
+static tree
+modernize_newlines_pass (tree t) {
+  return modernize_newlines (t, false);
+}
+
+static tree
+merge_successive_withs_pass (tree t) {
+  return merge_successive_withs (t, false);
+}
+
+static post_pass finalize_textm_passes[]= {
+    {"Downgrade newlines", downgrade_newlines, "!emptyline geometry"},
+    {"Modernize newlines", modernize_newlines_pass, ""},
+    {"Merge successive withs", merge_successive_withs_pass, "with"},
+    {"Unnest withs", unnest_withs, "with"},
+    {"Remove empty withs", remove_empty_withs, "with"},
+    {"Nonumber to eqnumber", nonumber_to_eqnumber,
+     "eqnarray eqnarray* gather gather* multline multline* align align* "
+     "alignat alignat* flalign flalign*"},
+    {"Eat space around control", eat_space_around_control, ""},
+    {"Remove superfluous newlines", remove_superfluous_newlines, ""},
+    {"Concat document correct", concat_document_correct, ""},
+    {"Remove labels from sections", remove_labels_from_sections, "label"},
+    {"Concat sections and labels", concat_sections_and_labels, "label"},
+    {"Clean vspace", clean_vspace, ""}};
+
 tree
 finalize_textm (tree t) {
-  // cout << "Downgrade newlines\n";
-  t= downgrade_newlines (t);
-  // cout << "Remove geometry\n";
-  t= remove_geometry (t);
-  // cout << "Modernize newlines\n";
-  t= modernize_newlines (t, false);
-  // cout << "Merge successive withs\n";
-  t= merge_successive_withs (t);
-  // cout << "Unnest withs\n";
-  t= unnest_withs (t);
-  // cout << "Remove empty withs\n";
-  t= remove_empty_withs (t);
-  // cout << "Nonumber to eqnumber\n";
-  t= nonumber_to_eqnumber (t);
-  // cout << "Eat space around control\n";
-  t= eat_space_around_control (t);
-  // cout << "Remove superfluous newlines\n";
-  t= remove_superfluous_newlines (t);
-  // cout << "Concat document correct\n";
-  t= concat_document_correct (t);
-  // cout << "Remove labels from sections\n";
-  t= remove_labels_from_sections (t);
-  // cout << "Concat sections and labels\n";
-  t= concat_sections_and_labels (t);
-  // cout << "Clean vspace\n";
-  t= clean_vspace (t);
+  t= run_post_passes (t, finalize_textm_passes,
+                      N_POST_PASSES (finalize_textm_passes));
   // cout << "Simplify correct\n";
   return simplify_correct (t);
 }
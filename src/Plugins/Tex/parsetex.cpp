@@ -12,6 +12,9 @@
 #include "Tex/convert_tex.hpp"
 #include "Tex/tex.hpp"
 #include "converter.hpp"
+#include "data_cache.hpp"
+#include "iterator.hpp"
+#include "merge_sort.hpp"
 #include "tree_helper.hpp"
 #include "wencoding.hpp"
 
@@ -52,6 +55,33 @@ string verbatim_escape (string s);
  * latex_arity instead of command_type and command_arity.
  ******************************************************************************/
 
+struct latex_piece {
+  array<tree>                    parsed;
+  array<bool>                    first;
+  char                           lf;
+  hashmap<string, string>        types;
+  hashmap<string, int>           arities;
+  hashmap<string, array<string>> defs;
+  hashmap<string, bool>          packages;
+  unsigned long long             delta;
+  int                            used; // last use, for evicting old pieces
+};
+
+enum latex_token_kind {
+  LATEX_TOKEN_COMMAND,
+  LATEX_TOKEN_BLANKS,
+  LATEX_TOKEN_NEWLINE,
+  LATEX_TOKEN_COMMENT,
+  LATEX_TOKEN_TEXT
+};
+
+struct latex_token {
+  int start;
+  int end;
+  int kind;
+  int name; // interned command name, or -1
+};
+
 struct latex_parser {
   int                   level;
   bool                  unicode;
@@ -59,9 +89,15 @@ struct latex_parser {
   bool                  pic;
   hashmap<string, bool> loaded_package;
   hashmap<string, bool> loaded_include;
+  array<string>             token_sources; // recently tokenized sources
+  array<array<latex_token>> token_streams; // and their tokens
   latex_parser (bool unicode2) : level (0), unicode (unicode2) {}
   void latex_error (string s, int i, string message);
 
+  array<latex_token> tokens (string s);
+  int                command_at (string s, int i, int& end);
+  int                blanks_end (string s, int i);
+
   bool is_opening_option (char c);
   bool is_substituable (tree t);
   bool contains_substituable (tree t);
@@ -82,7 +118,8 @@ struct latex_parser {
                     tree opt= tree (CONCAT));
   tree parse_char_code (string s, int& i);
 
-  tree parse (string s, int change);
+  latex_piece parse_piece (string s);
+  tree        parse (string s, int change);
 };
 
 /******************************************************************************
@@ -173,6 +210,228 @@ test_env (string s, int i, string name, bool end= false) {
   return false;
 }
 
+/******************************************************************************
+ * Tokenization of the source
+ *******************************************************************************
+ * A source string is cut once into a stream of tokens: command names, runs
+ * of blanks, newlines, comments and runs of other text.  Command names are
+ * interned together with the properties the dispatch below needs, so that
+ * a backslash costs a bisection in the stream instead of a series of
+ * substring comparisons.  Verbatim material, lengths and arguments are
+ * still cut out of the string by position.
+ ******************************************************************************/
+
+#define LATEX_NAME_SKIP 1
+#define LATEX_NAME_CHAR 2
+#define LATEX_NAME_FRAC 4
+#define LATEX_NAME_SP 8
+#define LATEX_NAME_SB 16
+#define LATEX_NAME_PMATRIX 32
+#define LATEX_NAME_VERB 64
+#define LATEX_NAME_URL 128
+#define LATEX_NAME_PATH 256
+#define LATEX_NAME_HREF 512
+#define LATEX_NAME_BGROUP 1024
+#define LATEX_NAME_BEGIN 2048
+
+static array<string> latex_names;      // interned command names
+static array<int>    latex_name_flags; // their LATEX_NAME_* properties
+static array<int>    latex_name_table; // open addressing, -1 if free
+
+static int
+latex_name_classify (string name) {
+  // The prefix tests mirror the character tests the parser used to do
+  int f= 0;
+  if (starts (name, "\\hskip") || starts (name, "\\vskip"))
+    f|= LATEX_NAME_SKIP;
+  if (starts (name, "\\char")) f|= LATEX_NAME_CHAR;
+  if (starts (name, "\\over") || starts (name, "\\atop") ||
+      starts (name, "\\choose"))
+    f|= LATEX_NAME_FRAC;
+  if (name == "\\sp") f|= LATEX_NAME_SP;
+  if (name == "\\sb") f|= LATEX_NAME_SB;
+  if (starts (name, "\\pmatrix")) f|= LATEX_NAME_PMATRIX;
+  if (starts (name, "\\verb")) f|= LATEX_NAME_VERB;
+  if (starts (name, "\\url")) f|= LATEX_NAME_URL;
+  if (starts (name, "\\path")) f|= LATEX_NAME_PATH;
+  if (starts (name, "\\href")) f|= LATEX_NAME_HREF;
+  if (starts (name, "\\bgroup")) f|= LATEX_NAME_BGROUP;
+  if (name == "\\begin") f|= LATEX_NAME_BEGIN;
+  return f;
+}
+
+static unsigned int
+latex_name_hash (string s, int start, int end) {
+  unsigned int h= 2166136261U;
+  for (int k= start; k < end; k++)
+    h= (h ^ ((unsigned char) s[k])) * 16777619U;
+  return h;
+}
+
+static void
+latex_name_rehash (int size) {
+  latex_name_table= array<int> (size);
+  for (int k= 0; k < size; k++)
+    latex_name_table[k]= -1;
+  for (int id= 0; id < N (latex_names); id++) {
+    string name= latex_names[id];
+    int    pos = latex_name_hash (name, 0, N (name)) & (size - 1);
+    while (latex_name_table[pos] >= 0)
+      pos= (pos + 1) & (size - 1);
+    latex_name_table[pos]= id;
+  }
+}
+
+static int
+latex_intern (string s, int start, int end) {
+  // Number of the name s (start, end), without allocating known names
+  if (2 * (N (latex_names) + 1) > N (latex_name_table))
+    latex_name_rehash (max (256, 2 * N (latex_name_table)));
+  int mask= N (latex_name_table) - 1;
+  int pos = latex_name_hash (s, start, end) & mask;
+  int len = end - start;
+  while (latex_name_table[pos] >= 0) {
+    int     id  = latex_name_table[pos];
+    string& name= latex_names[id];
+    int     k   = 0;
+    if (N (name) == len)
+      while (k < len && name[k] == s[start + k])
+        k++;
+    if (k == len && N (name) == len) return id;
+    pos= (pos + 1) & mask;
+  }
+  int id= N (latex_names);
+  latex_names << s (start, end);
+  latex_name_flags << latex_name_classify (latex_names[id]);
+  latex_name_table[pos]= id;
+  return id;
+}
+
+static int
+latex_command_end (string s, int i) {
+  // End of the name of the command starting with the backslash at i
+  int n= N (s);
+  i++;
+  if (i < n && is_tex_alpha (s[i])) {
+    while (i < n && is_tex_alpha (s[i]))
+      i++;
+  }
+  else if (i < n) i++;
+  return i;
+}
+
+static array<latex_token>
+latex_tokenize (string s) {
+  array<latex_token> r;
+  int                i= 0, n= N (s);
+  while (i < n) {
+    latex_token tok;
+    tok.start= i;
+    tok.name = -1;
+    char c   = s[i];
+    if (c == '\\') {
+      i       = latex_command_end (s, i);
+      tok.kind= LATEX_TOKEN_COMMAND;
+      tok.name= latex_intern (s, tok.start, i);
+    }
+    else if (c == ' ' || c == '\t' || c == '\r') {
+      while (i < n && (s[i] == ' ' || s[i] == '\t' || s[i] == '\r'))
+        i++;
+      tok.kind= LATEX_TOKEN_BLANKS;
+    }
+    else if (c == '\n') {
+      i++;
+      tok.kind= LATEX_TOKEN_NEWLINE;
+    }
+    else if (c == '%') {
+      while (i < n && s[i] != '\n')
+        i++;
+      tok.kind= LATEX_TOKEN_COMMENT;
+    }
+    else {
+      while (i < n && s[i] != '\\' && s[i] != ' ' && s[i] != '\t' &&
+             s[i] != '\r' && s[i] != '\n' && s[i] != '%')
+        i++;
+      tok.kind= LATEX_TOKEN_TEXT;
+    }
+    tok.end= i;
+    r << tok;
+  }
+  return r;
+}
+
+static int
+latex_token_at (array<latex_token> a, int i) {
+  // Index of the token starting at position i, or -1
+  int lo= 0, hi= N (a);
+  while (lo < hi) {
+    int mid= (lo + hi) >> 1;
+    if (a[mid].start < i) lo= mid + 1;
+    else hi= mid;
+  }
+  if (lo < N (a) && a[lo].start == i) return lo;
+  return -1;
+}
+
+#define LATEX_TOKEN_SOURCES 8
+
+array<latex_token>
+latex_parser::tokens (string s) {
+  // The parser comes back to the same few strings (the document piece and
+  // the expansions of macros being parsed), so keep the most recent ones
+  if (N (s) == 0) return array<latex_token> ();
+  int k= N (token_sources) - 1;
+  while (k >= 0 && (N (token_sources[k]) != N (s) ||
+                    &(token_sources[k][0]) != &(s[0])))
+    k--;
+  if (k < 0) {
+    if (N (token_sources) == LATEX_TOKEN_SOURCES) {
+      token_sources= range (token_sources, 1, LATEX_TOKEN_SOURCES);
+      token_streams= range (token_streams, 1, LATEX_TOKEN_SOURCES);
+    }
+    token_sources << s;
+    token_streams << latex_tokenize (s);
+    k= N (token_sources) - 1;
+  }
+  array<latex_token> r= token_streams[k];
+  if (k < N (token_sources) - 1) {
+    // move to the most recent slot
+    string src= token_sources[k];
+    for (int j= k + 1; j < N (token_sources); j++) {
+      token_sources[j - 1]= token_sources[j];
+      token_streams[j - 1]= token_streams[j];
+    }
+    token_sources[N (token_sources) - 1]= src;
+    token_streams[N (token_streams) - 1]= r;
+  }
+  return r;
+}
+
+int
+latex_parser::command_at (string s, int i, int& end) {
+  // Interned name of the command starting with the backslash at i
+  array<latex_token> a= tokens (s);
+  int                k= latex_token_at (a, i);
+  if (k >= 0 && a[k].kind == LATEX_TOKEN_COMMAND) {
+    end= a[k].end;
+    return a[k].name;
+  }
+  // Not aligned on the stream, e.g. after verbatim material containing '%'
+  end= latex_command_end (s, i);
+  return latex_intern (s, i, end);
+}
+
+int
+latex_parser::blanks_end (string s, int i) {
+  array<latex_token> a= tokens (s);
+  int                k= latex_token_at (a, i);
+  if (k >= 0 && a[k].kind == LATEX_TOKEN_BLANKS) return a[k].end;
+  int n= N (s);
+  while ((i < n) && ((s[i] == ' ') || (s[i] == '\t') || (s[i] == '\r')))
+    i++;
+  return i;
+}
+
 /******************************************************************************
  * Main parsing routine
  ******************************************************************************/
@@ -203,17 +462,30 @@ latex_parser::parse (string s, int& i, string stop, int change) {
   command_arity->extend ();
   command_def->extend ();
 
+  // The stop conditions are tested for each character; decode them once
+  bool stop_none  = N (stop) == 0;
+  bool stop_char  = N (stop) == 1;
+  bool stop_math  = !stop_none && stop[0] == '$';
+  bool stop_dollar= stop == "$$";
+  bool stop_denom = stop == "denom";
+  bool stop_group = stop == "\\egroup";
+
   while ((i < n) && is_space (s[i]))
     i++;
-  while ((i < n) && no_error && (s[i] != '\0' || N (stop) != 0) &&
-         (N (stop) != 1 || s[i] != stop[0]) &&
-         (s[i] != '$' || stop != "$$" || i + 1 >= n || s[i + 1] != '$') &&
-         (stop != "denom" ||
-          (s[i] != '$' && s[i] != '}' && (i + 2 > n || s (i, i + 2) != "\\]") &&
-           (i + 2 > n || s (i, i + 2) != "\\)") &&
-           (i + 4 > n || s (i, i + 4) != "\\end"))) &&
-         (stop != "\\egroup" || i + 7 > n || s (i, i + 7) != "\\egroup")) {
-    if (N (stop) != 0 && stop[0] == '$' && test (s, i, "\\begin{")) {
+  while ((i < n) && no_error && (s[i] != '\0' || !stop_none) &&
+         (!stop_char || s[i] != stop[0]) &&
+         (s[i] != '$' || !stop_dollar || i + 1 >= n || s[i + 1] != '$') &&
+         (!stop_denom ||
+          (s[i] != '$' && s[i] != '}' && !test (s, i, "\\]") &&
+           !test (s, i, "\\)") && !test (s, i, "\\end"))) &&
+         (!stop_group || !test (s, i, "\\egroup"))) {
+    int name= -1, name_end= i, flags= 0;
+    if (s[i] == '\\') {
+      name = command_at (s, i, name_end);
+      flags= latex_name_flags[name];
+    }
+    if (stop_math && (flags & LATEX_NAME_BEGIN) && name_end < n &&
+        s[name_end] == '{') {
       // Emergency break from math mode on certain text environments
       int j= i + 7, start= j;
       while (j < n && s[j] != '}')
@@ -230,8 +502,7 @@ latex_parser::parse (string s, int& i, string stop, int change) {
     case ' ':
     case '\t':
     case '\r':
-      while ((i < n) && ((s[i] == ' ') || (s[i] == '\t') || (s[i] == '\r')))
-        i++;
+      i= blanks_end (s, i);
       if ((i < n) && (s[i] != '\n')) t << " ";
       break;
     case '\n':
@@ -262,8 +533,7 @@ latex_parser::parse (string s, int& i, string stop, int change) {
       break;
     case '\\':
       // TODO: move this in parse_command
-      if ((i + 6) < n &&
-          (s (i + 1, i + 6) == "hskip" || s (i + 1, i + 6) == "vskip")) {
+      if ((i + 6) < n && (flags & LATEX_NAME_SKIP)) {
         string skip= s (i + 1, i + 6);
         i+= 7;
         bool tmp_textm_class_flag= textm_class_flag;
@@ -274,13 +544,14 @@ latex_parser::parse (string s, int& i, string stop, int change) {
         }
         textm_class_flag= tmp_textm_class_flag;
       }
-      else if ((i + 6) < n && s (i + 1, i + 5) == "char")
+      else if ((i + 6) < n && (flags & LATEX_NAME_CHAR))
         t << parse_char_code (s, i);
       // end of move
-      else if (((i + 7) < n && !is_tex_alpha (s (i + 5, i + 7)) &&
-                (s (i, i + 5) == "\\over" || s (i, i + 5) == "\\atop")) ||
-               ((i + 9) < n && !is_tex_alpha (s (i + 7, i + 9)) &&
-                s (i, i + 7) == "\\choose")) {
+      else if ((flags & LATEX_NAME_FRAC) &&
+               (((i + 7) < n && s[i + 1] != 'c' &&
+                 (!is_tex_alpha (s[i + 5]) || !is_tex_alpha (s[i + 6]))) ||
+                ((i + 9) < n && s[i + 1] == 'c' &&
+                 (!is_tex_alpha (s[i + 7]) || !is_tex_alpha (s[i + 8]))))) {
         int start= i;
         i++;
         while (i < n && is_alpha (s[i]))
@@ -299,17 +570,15 @@ latex_parser::parse (string s, int& i, string stop, int change) {
         tree den= parse (s, i, "denom");
         t << tree (TUPLE, fr_cmd, num, den);
       }
-      else if ((i + 5) < n && s (i, i + 3) == "\\sp" &&
-               !is_tex_alpha (s[i + 3])) {
+      else if ((i + 5) < n && (flags & LATEX_NAME_SP)) {
         i+= 3;
         t << parse_command (s, i, "\\<sup>");
       }
-      else if ((i + 5) < n && s (i, i + 3) == "\\sb" &&
-               !is_tex_alpha (s[i + 3])) {
+      else if ((i + 5) < n && (flags & LATEX_NAME_SB)) {
         i+= 3;
         t << parse_command (s, i, "\\<sub>");
       }
-      else if ((i + 10) < n && s (i, i + 8) == "\\pmatrix") {
+      else if ((i + 10) < n && (flags & LATEX_NAME_PMATRIX)) {
         i+= 8;
         tree arg= parse_command (s, i, "\\pmatrix");
         if (is_tuple (arg, "\\pmatrix", 1)) arg= arg[1];
@@ -481,26 +750,30 @@ latex_parser::parse (string s, int& i, string stop, int change) {
 
 tree
 latex_parser::parse_backslash (string s, int& i, int change) {
-  int n= N (s);
-  if (((i + 7) < n) && (s (i, i + 5) == "\\verb")) {
+  int n= N (s), name_end;
+  int name = command_at (s, i, name_end);
+  int flags= latex_name_flags[name];
+  if (((i + 7) < n) && (flags & LATEX_NAME_VERB)) {
     i+= 6;
     return parse_verbatim (s, i, s (i - 1, i), "\\verbatim");
   }
-  if (((i + 6) < n) && (s (i, i + 4) == "\\url") && s[i + 4] != '{' &&
+  if (((i + 6) < n) && (flags & LATEX_NAME_URL) && s[i + 4] != '{' &&
       s[i + 4] != ' ') {
     i+= 5;
     return parse_verbatim (s, i, s (i - 1, i), "\\url");
   }
-  if (((i + 7) < n) && (s (i, i + 5) == "\\path") && s[i + 5] != '{' &&
+  if (((i + 7) < n) && (flags & LATEX_NAME_PATH) && s[i + 5] != '{' &&
       s[i + 5] != ' ') {
     i+= 6;
     return parse_verbatim (s, i, s (i - 1, i), "\\verbatim");
   }
-  if (((i + 29) < n) && (s (i, i + 16) == "\\begin{verbatim}")) {
+  if (((i + 29) < n) && (flags & LATEX_NAME_BEGIN) &&
+      test (s, i, "\\begin{verbatim}")) {
     i+= 16;
     return parse_verbatim (s, i, "\\end{verbatim}", "verbatim");
   }
-  if (((i + 27) < n) && (s (i, i + 14) == "\\begin{tmcode}")) {
+  if (((i + 27) < n) && (flags & LATEX_NAME_BEGIN) &&
+      test (s, i, "\\begin{tmcode}")) {
     i+= 14;
     if (i < n && s[i] == '[') {
       i++;
@@ -510,11 +783,13 @@ latex_parser::parse_backslash (string s, int& i, int change) {
     }
     else return parse_alltt (s, i, "\\end{tmcode}", "tmcode");
   }
-  if (((i + 26) < n) && (s (i, i + 13) == "\\begin{alltt}")) {
+  if (((i + 26) < n) && (flags & LATEX_NAME_BEGIN) &&
+      test (s, i, "\\begin{alltt}")) {
     i+= 13;
     return parse_alltt (s, i, "\\end{alltt}", "verbatim-code");
   }
-  if (((i + 5) < n) && (s (i, i + 4) == "\\url") && !is_tex_alpha (s[i + 5])) {
+  if (((i + 5) < n) && (flags & LATEX_NAME_URL) &&
+      !is_tex_alpha (s[i + 5])) {
     i+= 4;
     while (i < n && (s[i] == ' ' || s[i] == '\n' || s[i] == '\t'))
       i++;
@@ -528,7 +803,7 @@ latex_parser::parse_backslash (string s, int& i, int change) {
     }
     return tree (TUPLE, "\\url", ss);
   }
-  if (((i + 6) < n) && (s (i, i + 5) == "\\href")) {
+  if (((i + 6) < n) && (flags & LATEX_NAME_HREF)) {
     i+= 5;
     while (i < n && (s[i] == ' ' || s[i] == '\n' || s[i] == '\t'))
       i++;
@@ -550,13 +825,13 @@ latex_parser::parse_backslash (string s, int& i, int change) {
     }
     return tree (TUPLE, "\\href", ss, u);
   }
-  if (((i + 8) < n) && (s (i, i + 7) == "\\bgroup")) {
+  if (((i + 8) < n) && (flags & LATEX_NAME_BGROUP)) {
     i+= 7;
     tree t (CONCAT);
     t << tree (TUPLE, "\\begingroup");
     t << parse (s, i, "\\egroup", change);
     t << tree (TUPLE, "\\endgroup");
-    if (((i + 8) < n) && (s (i, i + 7) == "\\egroup")) i+= 7;
+    if (((i + 8) < n) && test (s, i, "\\egroup")) i+= 7;
     if ((i < n) && (!is_space (s[i]))) return t;
     int ln= 0;
     while ((i < n) && is_space (s[i]))
@@ -594,11 +869,13 @@ latex_parser::parse_backslash (string s, int& i, int change) {
 
   /************************* normal commands *********************************/
   int start= i - 1;
-  while ((i < n) && is_tex_alpha (s[i]))
+  i        = name_end;
+  // The name is copied, since it ends up as a label of the parsed tree
+  string r= copy (latex_names[name]);
+  if ((i < n) && (s[i] == '*') && latex_type (r * "*") != "undefined") {
+    r << '*';
     i++;
-  if ((i < n) && (s[i] == '*') && latex_type (s (start, i + 1)) != "undefined")
-    i++;
-  string r= s (start, i);
+  }
   while ((i < n) && s[i] == ' ')
     i++;
   if (s[i] == '\n') {
@@ -1571,7 +1848,7 @@ from_char_code (int i) {
 
 tree
 latex_parser::parse_char_code (string s, int& i) {
-  if (s (i, i + 5) == "\\char") {
+  if (test (s, i, "\\char")) {
     i+= 5;
     while (i < N (s) && s[i] == ' ')
       i++;
@@ -1690,6 +1967,214 @@ skip_expansion (url u) {
          s == "tikz.sty" || s == "times.sty";
 }
 
+/******************************************************************************
+ * Memoized parsing of the pieces of a document
+ ******************************************************************************/
+
+#define LATEX_PIECE_MAX 4096 // number of cached pieces
+
+static hashmap<string, latex_piece> latex_piece_cache;
+static int                          latex_piece_tick= 0;
+
+static string
+latex_piece_key (string s, unsigned long long env, char lf, bool unicode,
+                 bool pic, bool algo) {
+  // 64 bit hash of the piece and of the context in which it is parsed
+  string key= cache_hexdigest (env) * ":" * string (lf);
+  key << (unicode ? "u" : "-") << (pic ? "p" : "-") << (algo ? "a" : "-");
+  key << (textm_class_flag ? "t" : "-") << as_string (get_file_focus ());
+  key << "\n" << s;
+  unsigned long long h= CACHE_HASH_SEED;
+  cache_hash (h, key);
+  string r (12);
+  for (int i= 0; i < 8; i++)
+    r[i]= (char) (h >> (8 * i));
+  for (int i= 0; i < 4; i++)
+    r[8 + i]= (char) (N (s) >> (8 * i));
+  return r;
+}
+
+static void
+latex_piece_evict () {
+  // Forget the pieces which were least recently used; at most half of
+  // the maximal number of pieces have been used during the last ticks
+  if (N (latex_piece_cache) <= LATEX_PIECE_MAX) return;
+  array<string>    old;
+  iterator<string> it= iterate (latex_piece_cache);
+  while (it->busy ()) {
+    string k= it->next ();
+    if (latex_piece_cache[k].used < latex_piece_tick - LATEX_PIECE_MAX / 2)
+      old << k;
+  }
+  for (int i= 0; i < N (old); i++)
+    latex_piece_cache->reset (old[i]);
+}
+
+static hashmap<string, bool>
+latex_copy_packages (hashmap<string, bool> h) {
+  hashmap<string, bool> r (false);
+  iterator<string>      it= iterate (h);
+  while (it->busy ()) {
+    string k= it->next ();
+    r (k)   = h[k];
+  }
+  return r;
+}
+
+template <class T>
+static array<string>
+latex_sorted_keys (hashmap<string, T> h) {
+  array<string>    keys;
+  iterator<string> it= iterate (h);
+  while (it->busy ())
+    keys << it->next ();
+  merge_sort (keys);
+  return keys;
+}
+
+static void
+latex_serialize_definitions (string& r, hashmap<string, string> types,
+                             hashmap<string, int>           arities,
+                             hashmap<string, array<string>> defs) {
+  // Canonical serialization, with the definitions sorted by name; the
+  // fields are separated by characters which cannot occur in LaTeX source
+  array<string> keys= latex_sorted_keys (types);
+  for (int i= 0; i < N (keys); i++)
+    r << "t\1" << keys[i] << "\1" << types[keys[i]] << "\2";
+  keys= latex_sorted_keys (arities);
+  for (int i= 0; i < N (keys); i++)
+    r << "a\1" << keys[i] << "\1" << as_string (arities[keys[i]]) << "\2";
+  keys= latex_sorted_keys (defs);
+  for (int i= 0; i < N (keys); i++) {
+    array<string> d= defs[keys[i]];
+    r << "d\1" << keys[i];
+    for (int j= 0; j < N (d); j++)
+      r << "\1" << d[j];
+    r << "\2";
+  }
+}
+
+static unsigned long long
+latex_delta_hash (latex_piece p) {
+  string r;
+  latex_serialize_definitions (r, p.types, p.arities, p.defs);
+  unsigned long long h= CACHE_HASH_SEED;
+  cache_hash (h, r);
+  return h;
+}
+
+static unsigned long long
+latex_global_hash () {
+  // The definitions which are in force before parsing a document, like
+  // those of a preamble parsed earlier or of bibtex fields
+  rel_hashmap<string, string>        types  = command_type;
+  rel_hashmap<string, int>           arities= command_arity;
+  rel_hashmap<string, array<string>> defs   = command_def;
+  hashmap<string, string>            no_types ("");
+  hashmap<string, int>               no_arities (0);
+  hashmap<string, array<string>>     no_defs (array<string> ());
+  string                             r;
+  for (; !is_nil (types); types= types->next) {
+    latex_serialize_definitions (r, types->item, no_arities, no_defs);
+    r << "\3";
+  }
+  for (; !is_nil (arities); arities= arities->next) {
+    latex_serialize_definitions (r, no_types, arities->item, no_defs);
+    r << "\3";
+  }
+  for (; !is_nil (defs); defs= defs->next) {
+    latex_serialize_definitions (r, no_types, no_arities, defs->item);
+    r << "\3";
+  }
+  unsigned long long h= CACHE_HASH_SEED;
+  cache_hash (h, r);
+  return h;
+}
+
+static unsigned long long
+latex_chain_hash (unsigned long long env, unsigned long long delta) {
+  unsigned long long h= CACHE_HASH_SEED;
+  cache_hash (h, cache_hexdigest (env) * cache_hexdigest (delta));
+  return h;
+}
+
+void
+latex_reset_pieces () {
+  latex_piece_cache= hashmap<string, latex_piece> ();
+  latex_piece_tick = 0;
+}
+
+static void
+latex_replay_piece (latex_piece p) {
+  command_type->extend ();
+  command_arity->extend ();
+  command_def->extend ();
+  iterator<string> it= iterate (p.types);
+  while (it->busy ()) {
+    string k        = it->next ();
+    command_type (k)= p.types[k];
+  }
+  it= iterate (p.arities);
+  while (it->busy ()) {
+    string k         = it->next ();
+    command_arity (k)= p.arities[k];
+  }
+  it= iterate (p.defs);
+  while (it->busy ()) {
+    string k       = it->next ();
+    command_def (k)= p.defs[k];
+  }
+  command_type->merge ();
+  command_arity->merge ();
+  command_def->merge ();
+}
+
+latex_piece
+latex_parser::parse_piece (string s) {
+  latex_piece p;
+  command_type->extend ();
+  command_arity->extend ();
+  command_def->extend ();
+  int j= 0;
+  while (j < N (s)) {
+    int start             = j;
+    command_type ("!mode")= "text";
+    command_type ("!em")  = "false";
+    p.parsed << parse (s, j, "", 2);
+    p.first << (start == 0);
+    if (j == start) j++;
+  }
+
+  // Record the definitions made by the piece, so that they can be replayed
+  iterator<string> it= iterate (command_type->item);
+  while (it->busy ()) {
+    string k   = it->next ();
+    p.types (k)= command_type->item[k];
+  }
+  it= iterate (command_arity->item);
+  while (it->busy ()) {
+    string k     = it->next ();
+    p.arities (k)= command_arity->item[k];
+  }
+  it= iterate (command_def->item);
+  while (it->busy ()) {
+    string k  = it->next ();
+    p.defs (k)= command_def->item[k];
+  }
+  p.lf      = lf;
+  p.packages= latex_copy_packages (loaded_package);
+  p.delta   = latex_delta_hash (p);
+
+  command_type->merge ();
+  command_arity->merge ();
+  command_def->merge ();
+  return p;
+}
+
+/******************************************************************************
+ * Parsing a complete document
+ ******************************************************************************/
+
 tree
 latex_parser::parse (string s, int change) {
   command_type->extend ();
@@ -1768,19 +2253,34 @@ latex_parser::parse (string s, int change) {
     else if ((i == 0 || s[i - 1] != '\\') && s[i] == '}') count--;
   a << s (start, i);
 
-  // We now parse each of the pieces
-  tree t (CONCAT);
+  // We now parse each of the pieces, reusing the pieces which did not
+  // change since a previous import under the same macro definitions
+  latex_piece_evict ();
+  tree               t (CONCAT);
+  unsigned long long env= latex_global_hash ();
   for (i= 0; i < N (a); i++) {
-    int j= 0;
-    while (j < N (a[i])) {
-      int start             = j;
-      command_type ("!mode")= "text";
-      command_type ("!em")  = "false";
-      tree u                = parse (a[i], j, "", 2);
-      if ((N (t) > 0) && (t[N (t) - 1] != '\n') && (start == 0)) t << "\n";
+    string      key= latex_piece_key (a[i], env, lf, unicode, pic,
+                                      loaded_package["algorithm2e"]);
+    latex_piece p;
+    latex_piece_tick++;
+    if (latex_piece_cache->contains (key)) {
+      latex_piece_cache (key).used= latex_piece_tick;
+      p                           = latex_piece_cache[key];
+      latex_replay_piece (p);
+      lf            = p.lf;
+      loaded_package= latex_copy_packages (p.packages);
+    }
+    else {
+      p                      = parse_piece (a[i]);
+      p.used                 = latex_piece_tick;
+      latex_piece_cache (key)= p;
+    }
+    env= latex_chain_hash (env, p.delta);
+    for (int k= 0; k < N (p.parsed); k++) {
+      tree u= copy (p.parsed[k]);  // the cached trees must stay pristine
+      if ((N (t) > 0) && (t[N (t) - 1] != '\n') && p.first[k]) t << "\n";
       if (is_concat (u)) t << A (u);
       else t << u;
-      if (j == start) j++;
     }
   }
 
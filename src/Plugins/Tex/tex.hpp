@@ -18,7 +18,10 @@
 
 tree   parse_latex (string s, bool change= false, bool as_pic= false);
 tree   parse_latex_document (string s, bool change= false, bool as_pic= false);
+void   latex_reset_pieces ();
 tree   latex_to_tree (tree t);
+tree   finalize_textm (tree t);
+void   set_post_pass_skipping (bool on);
 tree   latex_document_to_tree (string s, bool as_pic= false);
 tree   latex_class_document_to_tree (string s);
 string latex_verbarg_to_string (tree t);
@@ -12,6 +12,7 @@
 #include "Tex/convert_tex.hpp"
 #include "Tex/tex.hpp"
 #include "analyze.hpp"
+#include "data_cache.hpp"
 #include "fast_search.hpp"
 #include "file.hpp"
 #include "hashset.hpp"
@@ -161,15 +162,78 @@ latex_check_transparency (string ums, string s, hashmap<int, array<path>> corr,
 }
 
 /******************************************************************************
- * TeXmacs -> LaTeX conversion with source tracking
+ * Reuse of the conversions of unchanged paragraphs
+ *******************************************************************************
+ * Documents which are exported several times in a row (and the repeated
+ * conversions of the source tracking below) mostly only differ by a few
+ * paragraphs. The Scheme converter remembers the LaTeX trees of the
+ * paragraphs of the body (see tmtex-paragraph in tmtex.scm), and the
+ * preamble is still computed from the complete converted body. We pass it
+ * a stamp of everything outside the document which affects the conversion:
+ * the options, preferences, save target and style files. Documents with
+ * images or graphics are always converted from scratch, since their
+ * conversion writes picture files.
  ******************************************************************************/
 
+static bool
+latex_exports_pictures (tree t) {
+  if (is_atomic (t)) return false;
+  if (is_func (t, IMAGE) || is_func (t, GRAPHICS)) return true;
+  for (int i= 0; i < N (t); i++)
+    if (latex_exports_pictures (t[i])) return true;
+  return false;
+}
+
+static string
+latex_style_stamps (tree style) {
+  // modification times of the style files and packages of the document
+  string r;
+  if (is_atomic (style)) style= tuple (style);
+  for (int i= 0; i < N (style); i++)
+    if (is_atomic (style[i])) {
+      url styp= "$TEXMACS_STYLE_PATH";
+      url name= resolve (styp * (style[i]->label * ".ts"));
+      r << style[i]->label << ":";
+      if (is_none (name)) r << "-";
+      else r << as_string (last_modified (name, false));
+      r << ";";
+    }
+  return r;
+}
+
+static string
+latex_export_stamp (tree d, object opts) {
+  static const char* prefs[]= {"texmacs->latex:replace-style",
+                               "texmacs->latex:expand-macros",
+                               "texmacs->latex:expand-user-macros",
+                               "texmacs->latex:indirect-bib",
+                               "texmacs->latex:use-macros",
+                               "texmacs->latex:encoding",
+                               "texmacs->latex:source-tracking",
+                               "texmacs->latex:transparent-source-tracking"};
+  unsigned long long h= CACHE_HASH_SEED;
+  cache_hash (h, object_to_string (opts));
+  for (int i= 0; i < (int) (sizeof (prefs) / sizeof (const char*)); i++)
+    cache_hash (h, get_preference (prefs[i], "default"));
+  cache_hash (h, object_to_string (eval ("current-save-target")));
+  cache_hash (h, latex_style_stamps (extract (d, "style")));
+  return cache_hexdigest (h);
+}
+
 string
 tree_to_latex_document (tree d, object opts) {
   eval ("(use-modules (convert latex init-latex))");
+  if (!latex_exports_pictures (d)) {
+    object key= object ("texmacs->latex:paragraph-stamp");
+    opts      = cons (cons (key, object (latex_export_stamp (d, opts))), opts);
+  }
   return as_string (call ("texmacs->latex-document", object (d), opts));
 }
 
+/******************************************************************************
+ * TeXmacs -> LaTeX conversion with source tracking
+ ******************************************************************************/
+
 static tree
 purify (tree d) {
   tree v= extract (d, "TeXmacs");
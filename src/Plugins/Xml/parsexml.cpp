@@ -17,9 +17,7 @@
 #include "xml.hpp"
 #include <moebius/data/scheme.hpp>
 
-using moebius::data::block_to_scheme_tree;
 using moebius::data::scm_quote;
-using moebius::data::scm_unquote;
 
 #define xml_quote scm_quote
 // FIXME: to be checked that this is the correct quoting style
@@ -28,32 +26,9 @@ using moebius::data::scm_unquote;
  * Initialization
  ******************************************************************************/
 
-static hashset<string>         html_empty_tag_table;
-static hashset<string>         html_auto_close_table;
-static hashset<string>         html_block_table;
-static hashmap<string, string> html_entity ("");
-static hashmap<string, string> xml_entity ("");
-
-void
-load_entities (hashmap<string, string> table, string fname) {
-  string s;
-  if (DEBUG_CONVERT) debug_convert << "Loading " << fname << "\n";
-  if (load_string (url ("$TEXMACS_PATH/langs/encoding", fname), s, false))
-    return;
-  tree t= block_to_scheme_tree (s);
-  if (!is_tuple (t)) return;
-
-  int i, n= N (t);
-  for (i= 0; i < n; i++)
-    if (is_func (t[i], TUPLE, 2) && is_atomic (t[i][0]) &&
-        is_atomic (t[i][1])) {
-      string l= t[i][0]->label;
-      if (is_quoted (l)) l= scm_unquote (l);
-      string r= t[i][1]->label;
-      if (is_quoted (r)) r= scm_unquote (r);
-      table (l)= r;
-    }
-}
+static hashset<string> html_empty_tag_table;
+static hashset<string> html_auto_close_table;
+static hashset<string> html_block_table;
 
 xml_html_parser::xml_html_parser () : entities ("") {
   if (N (html_empty_tag_table) == 0) {
@@ -114,16 +89,6 @@ xml_html_parser::xml_html_parser () : entities ("") {
     html_block_table->insert ("fieldset");
     html_block_table->insert ("address");
   }
-
-  if (N (html_entity) == 0) {
-    load_entities (html_entity, "HTMLlat1.scm");
-    load_entities (html_entity, "HTMLspecial.scm");
-    load_entities (html_entity, "HTMLsymbol.scm");
-  }
-
-  if (xml_entity->empty ()) {
-    load_entities (xml_entity, "XML.scm");
-  }
 }
 
 /******************************************************************************
@@ -222,9 +187,9 @@ xml_html_parser::parse_name () {
 
 string
 xml_html_parser::expand_entity (string s) {
-  if (entities->contains (s)) return entities[s];
-  else if (s[0] == '&') {
-    if (N (s) > 1 && s[1] == '#') {
+  if (N (entities) != 0 && entities->contains (s)) return entities[s];
+  else if (N (s) > 1 && s[0] == '&') {
+    if (s[1] == '#') {
       int    i   = 2;
       bool   okay= false;
       string r   = convert_char_entity (s, i, okay);
@@ -232,15 +197,11 @@ xml_html_parser::expand_entity (string s) {
       return s;
     }
     else {
-      string ss= s (1, s[N (s) - 1] == ';' ? N (s) - 1 : N (s));
-      // XML/HTML entity references expand to character references
-      // so they need to be finalized a second time.
-      if (html && html_entity->contains (ss)) {
-        return expand_entity (html_entity[ss]);
-      }
-      else if (xml_entity->contains (ss)) {
-        return expand_entity (xml_entity[ss]);
-      }
+      // the predefined entities are looked up in place in static tables
+      int         n= N (s) - (s[N (s) - 1] == ';' ? 2 : 1);
+      const char* r= xml_entity_value (&s[1], n);
+      if (r == NULL && html) r= html_entity_value (&s[1], n);
+      if (r != NULL) return string (r);
     }
   }
   return s;
@@ -278,24 +239,40 @@ xml_html_parser::expand_entities (string s) {
 
 string
 xml_html_parser::parse_entity () {
-  string r= s->read (1);
+  string r;
+  r << s[0];
+  s+= 1;
   if (test (s, "#")) {
-    r << s->read (1);
+    r << s[0];
+    s+= 1;
     if (test (s, "x") || test (s, "X")) {
-      r << s->read (1);
-      while (s && is_hex_digit (s[0]))
-        r << s->read (1);
+      r << s[0];
+      s+= 1;
+      while (s && is_hex_digit (s[0])) {
+        r << s[0];
+        s+= 1;
+      }
     }
     else
-      while (s && is_digit (s[0]))
-        r << s->read (1);
+      while (s && is_digit (s[0])) {
+        r << s[0];
+        s+= 1;
+      }
   }
   else
-    while (s && is_name_char (s[0]))
-      r << s->read (1);
-  if (test (s, ";")) r << s->read (1);
-  string x= expand_entity (r);
-  if (x == r || r == "&lt;" || r == "&amp;") return x;
+    while (s && is_name_char (s[0])) {
+      r << s[0];
+      s+= 1;
+    }
+  if (test (s, ";")) {
+    r << s[0];
+    s+= 1;
+  }
+  // only entities declared in the DTD may expand to markup,
+  // character references and predefined entities are plain text
+  if (N (entities) == 0 || !entities->contains (r)) return expand_entity (r);
+  string x= entities[r];
+  if (x == r) return x;
   s->write (x);
   return "";
 }
@@ -569,6 +546,11 @@ xml_html_parser::build_valid_child (string parent, string child) {
   return true;
 }
 
+bool
+xml_html_parser::build_empty_tag (string tag) {
+  return html && html_empty_tag_table->contains (tag);
+}
+
 bool
 xml_html_parser::build_must_close (string tag) {
   if (build_valid_child (stack[0]->label, tag)) return false;
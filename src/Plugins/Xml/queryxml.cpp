@@ -34,13 +34,71 @@ get_attr_from_element (tree t, string name, string default_value) {
   for (int i= 1; i < N (t); i++)
     if (is_tuple (t[i]) && t[i][0]->label == "@") {
       for (int j= 1; j < N (t[i]); j++)
-        if (is_tuple (t[i][j]) && t[i][j][0]->label == name) {
+        if (is_tuple (t[i][j]) && N (t[i][j]) > 1 &&
+            t[i][j][0]->label == name) {
           return raw_unquote (t[i][j][1]->label);
         }
     }
   return default_value;
 }
 
+/******************************************************************************
+ * Indexed queries
+ ******************************************************************************/
+
+xml_index_rep::xml_index_rep (tree t)
+    : root (t), by_name (array<tree> ()), by_attr (array<tree> ()) {
+  add (t);
+}
+
+void
+xml_index_rep::add (tree t) {
+  // same traversal order as find_first_element_by_name
+  if (!is_tuple (t) || N (t) == 0 || !is_atomic (t[0])) return;
+  add_element (t);
+  for (int i= 1; i < N (t); i++)
+    if (is_tuple (t[i]) && N (t[i]) > 0 && t[i][0] != "@") add (t[i]);
+}
+
+void
+xml_index_rep::add_element (tree t) {
+  string name= t[0]->label;
+  if (!by_name->contains (name)) by_name (name)= array<tree> ();
+  by_name (name) << t;
+  for (int i= 1; i < N (t); i++)
+    if (is_tuple (t[i]) && N (t[i]) > 0 && t[i][0] == "@")
+      for (int j= 1; j < N (t[i]); j++)
+        if (is_tuple (t[i][j]) && N (t[i][j]) > 0 && is_atomic (t[i][j][0])) {
+          string attr= t[i][j][0]->label;
+          if (!by_attr->contains (attr)) by_attr (attr)= array<tree> ();
+          by_attr (attr) << t;
+        }
+}
+
+tree
+find_first_element_by_name (xml_index idx, string name) {
+  if (!idx->by_name->contains (name)) return tree ();
+  return idx->by_name[name][0];
+}
+
+array<tree>
+find_elements_by_name (xml_index idx, string name) {
+  return idx->by_name[name];
+}
+
+array<tree>
+find_elements_by_attr (xml_index idx, string attr) {
+  return idx->by_attr[attr];
+}
+
+array<tree>
+find_elements_by_attr (xml_index idx, string attr, string value) {
+  array<tree> a= idx->by_attr[attr], r;
+  for (int i= 0; i < N (a); i++)
+    if (get_attr_from_element (a[i], attr, "") == value) r << a[i];
+  return r;
+}
+
 // See https://www.w3.org/TR/css-values-3/#absolute-lengths
 static int
 cm2pt (double cm) {
@@ -0,0 +1,369 @@
+
+/******************************************************************************
+ * MODULE     : streamxml.cpp
+ * DESCRIPTION: event driven parsing of xml documents read chunk by chunk
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include "file.hpp"
+#include "tree_helper.hpp"
+#include "xml.hpp"
+#include <moebius/data/scheme.hpp>
+
+#include <stdio.h>
+
+using moebius::data::scm_quote;
+
+#define xml_quote scm_quote
+#define XML_STREAM_CHUNK 65536
+
+/******************************************************************************
+ * Splitting the input into tokens
+ ******************************************************************************/
+
+xml_stream_parser::xml_stream_parser (xml_consumer& out2, bool html)
+    : out (out2), pos (0), is_cr (false), scan (0), scan_depth (0),
+      scan_quote (0), scan_prev (0) {
+  helper.html = html;
+  helper.stack= tuple ("<bottom>");
+}
+
+int
+xml_stream_parser::token_end (bool last) {
+  // at least nine characters are needed in order to recognize "<![CDATA["
+  // an incomplete token is not rescanned from its start when the next
+  // chunk arrives: the scan resumes from where it stopped
+  int n= N (buf);
+  if (!last && n - pos < 9) return -1;
+  string close;
+  if (test (buf, pos, "<!--")) close= "-->";
+  else if (test (buf, pos, "<![CDATA[")) close= "]]>";
+  else if (test (buf, pos, "<?")) close= "?>";
+  if (N (close) != 0) {
+    int from= max (pos + 2, pos + scan - N (close) + 1);
+    int e   = search_forwards (close, from, buf);
+    scan    = 0;
+    if (e >= 0) return e + N (close);
+    if (last) return n;
+    scan= n - pos;
+    return -1;
+  }
+
+  // skip quoted attribute values and the internal subset of a DOCTYPE
+  bool dt   = test (buf, pos, "<!DOCTYPE");
+  int  depth= 0, start= pos + 1;
+  char quote= 0, prev= 0;
+  if (scan > 0) {
+    depth= scan_depth;
+    quote= scan_quote;
+    prev = scan_prev;
+    start= pos + scan;
+  }
+  scan= 0;
+  for (int i= start; i < n; i++) {
+    char c= buf[i];
+    if (quote != 0) {
+      if (c == quote) quote= 0;
+    }
+    else if ((c == '\42' || c == '\'') && (dt || prev == '=')) quote= c;
+    else if (dt && c == '[') depth++;
+    else if (dt && c == ']') depth--;
+    else if (c == '>' && depth <= 0) return i + 1;
+    if (!is_space (c)) prev= c;
+  }
+  if (last) return n;
+  scan      = n - pos;
+  scan_depth= depth;
+  scan_quote= quote;
+  scan_prev = prev;
+  return -1;
+}
+
+int
+xml_stream_parser::text_end (bool last) {
+  int n= N (buf);
+  int e= search_forwards ("<", pos, buf);
+  if (e >= 0) return e;
+  if (last) return n;
+  // do not cut an entity which may be continued in the next chunk
+  for (int i= n - 1; i >= pos; i--)
+    if (buf[i] == '&') return i;
+    else if (!helper.is_name_char (buf[i]) && buf[i] != '#') break;
+  return n;
+}
+
+/******************************************************************************
+ * Reporting events
+ ******************************************************************************/
+
+void
+xml_stream_parser::open_element (string name) {
+  // helper.stack mirrors the open elements for the Html error correction
+  open << name;
+  helper.stack= tuple (name, helper.stack);
+}
+
+void
+xml_stream_parser::pop_element () {
+  string top= open[N (open) - 1];
+  open->resize (N (open) - 1);
+  helper.stack= helper.stack[1];
+  out.end_element (top);
+}
+
+void
+xml_stream_parser::close_element (string name) {
+  int k= N (open) - 1;
+  while (k >= 0 && open[k] != name)
+    k--;
+  if (k < 0) return;
+  while (N (open) > k)
+    pop_element ();
+}
+
+void
+xml_stream_parser::process_token (string token) {
+  helper.s= parse_string (token);
+  if (test (token, 0, "</")) {
+    tree t= helper.parse_closing ();
+    close_element (t[1]->label);
+  }
+  else if (test (token, 0, "<?")) {
+    tree t= helper.parse_pi ();
+    out.processing_instruction (t[1]->label, t[2]->label);
+  }
+  else if (test (token, 0, "<!--")) {
+    tree t= helper.parse_comment ();
+    out.comment (t[1]->label);
+  }
+  else if (test (token, 0, "<![CDATA[")) {
+    tree t= helper.parse_cdata ();
+    out.cdata (t[1]->label);
+  }
+  else if (test (token, 0, "<!DOCTYPE")) {
+    // entity declarations are recorded in helper.entities
+    tree t= helper.parse_doctype ();
+    out.doctype (t[1]->label);
+  }
+  else if (test (token, 0, "<!")) (void) helper.parse_misc ();
+  else {
+    tree   t    = helper.parse_opening ();
+    string name = t[1]->label;
+    tree   attrs= tuple ();
+    for (int i= 2; i < N (t); i++)
+      attrs << t[i];
+    if (t[0] == "begin")
+      while (N (open) > 0 && helper.build_must_close (name))
+        pop_element ();
+    out.start_element (name, attrs);
+    if (t[0] == "tag" || helper.build_empty_tag (name)) out.end_element (name);
+    else open_element (name);
+  }
+}
+
+void
+xml_stream_parser::process_text (string text) {
+  string r;
+  int    i= 0, n= N (text);
+  while (i < n) {
+    if (text[i] == '&') {
+      int start= i++;
+      if (i < n && text[i] == '#') {
+        i++;
+        if (i < n && (text[i] == 'x' || text[i] == 'X')) {
+          i++;
+          while (i < n && is_hex_digit (text[i]))
+            i++;
+        }
+        else
+          while (i < n && is_digit (text[i]))
+            i++;
+      }
+      else
+        while (i < n && helper.is_name_char (text[i]))
+          i++;
+      if (i < n && text[i] == ';') i++;
+      r << helper.expand_entity (text (start, i));
+    }
+    else r << text[i++];
+  }
+  if (N (r) != 0) out.characters (r);
+}
+
+void
+xml_stream_parser::process (bool last) {
+  while (pos < N (buf)) {
+    if (buf[pos] == '<') {
+      int e= token_end (last);
+      if (e < 0) return;
+      string token= buf (pos, e);
+      pos         = e;
+      process_token (token);
+    }
+    else {
+      int e= text_end (last);
+      if (e <= pos) return;
+      string text= buf (pos, e);
+      pos        = e;
+      process_text (text);
+    }
+  }
+}
+
+/******************************************************************************
+ * Feeding the parser
+ ******************************************************************************/
+
+void
+xml_stream_parser::feed (string chunk) {
+  if (pos > 0) {
+    buf= buf (pos, N (buf));
+    pos= 0;
+  }
+  // end of line handling, as in xml_html_parser::parse
+  int i, n= N (chunk);
+  for (i= 0; i < n; i++) {
+    bool prev_is_cr= is_cr;
+    char c         = chunk[i];
+    is_cr          = (c == '\15');
+    if (is_cr) buf << '\12';
+    else if (!prev_is_cr || c != '\12') buf << c;
+  }
+  process (false);
+}
+
+void
+xml_stream_parser::finish () {
+  process (true);
+  buf = "";
+  pos = 0;
+  scan= 0;
+  while (N (open) > 0)
+    pop_element ();
+}
+
+/******************************************************************************
+ * Building the same tree as parse_xml
+ ******************************************************************************/
+
+xml_tree_builder::xml_tree_builder (bool indexed2) : indexed (indexed2) {
+  stack << tuple ("*TOP*");
+  if (indexed) index->add_element (stack[0]);
+}
+
+void
+xml_tree_builder::flush () {
+  if (N (text) == 0) return;
+  stack[N (stack) - 1] << xml_quote (text);
+  text= "";
+}
+
+void
+xml_tree_builder::start_element (string name, tree attrs) {
+  flush ();
+  tree tag= tuple (name);
+  tree as = tuple ("@");
+  for (int i= 0; i < N (attrs); i++)
+    if (N (attrs[i]) == 2) as << tuple (attrs[i][1]);
+    else as << tuple (attrs[i][1]->label, xml_quote (attrs[i][2]->label));
+  if (N (as) > 1) tag << as;
+  // the children are appended to the same tree, so it can be indexed now
+  if (indexed) index->add_element (tag);
+  stack << tag;
+}
+
+void
+xml_tree_builder::end_element (string name) {
+  (void) name;
+  flush ();
+  if (N (stack) < 2) return;
+  tree t= stack[N (stack) - 1];
+  stack->resize (N (stack) - 1);
+  stack[N (stack) - 1] << t;
+}
+
+void
+xml_tree_builder::characters (string s) {
+  text << s;
+}
+
+void
+xml_tree_builder::cdata (string s) {
+  flush ();
+  stack[N (stack) - 1] << xml_quote (s);
+}
+
+void
+xml_tree_builder::processing_instruction (string target, string data) {
+  flush ();
+  stack[N (stack) - 1] << tuple ("*PI*", target, xml_quote (data));
+}
+
+void
+xml_tree_builder::comment (string s) {
+  (void) s;
+  flush ();
+}
+
+void
+xml_tree_builder::doctype (string name) {
+  flush ();
+  stack[N (stack) - 1] << tuple ("*DOCTYPE*", xml_quote (name));
+}
+
+tree
+xml_tree_builder::result () {
+  flush ();
+  while (N (stack) > 1)
+    end_element ("");
+  index->root= stack[0];
+  return stack[0];
+}
+
+/******************************************************************************
+ * Interface
+ ******************************************************************************/
+
+void
+stream_xml (string s, xml_consumer& out, bool html) {
+  xml_stream_parser parser (out, html);
+  parser.feed (s);
+  parser.finish ();
+}
+
+bool
+stream_xml_file (url u, xml_consumer& out, bool html) {
+  c_string name (concretize (u));
+  FILE*    f= fopen (name, "rb");
+  if (f == NULL) return true;
+  xml_stream_parser parser (out, html);
+  char*             chunk= tm_new_array<char> (XML_STREAM_CHUNK);
+  while (true) {
+    size_t k= fread (chunk, 1, XML_STREAM_CHUNK, f);
+    if (k == 0) break;
+    parser.feed (string (chunk, (int) k));
+  }
+  tm_delete_array (chunk);
+  fclose (f);
+  parser.finish ();
+  return false;
+}
+
+tree
+parse_xml_file (url u) {
+  xml_tree_builder builder;
+  (void) stream_xml_file (u, builder);
+  return builder.result ();
+}
+
+xml_index
+parse_xml_index (string s) {
+  xml_tree_builder builder (true);
+  stream_xml (s, builder);
+  (void) builder.result ();
+  return builder.index;
+}
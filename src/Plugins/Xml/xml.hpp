@@ -18,6 +18,7 @@
 #include "parse_string.hpp"
 #include "string.hpp"
 #include "tree.hpp"
+#include "url.hpp"
 
 /******************************************************************************
  * The xml/html parser aims to parse a superset of the set of valid documents.
@@ -89,6 +90,7 @@ struct xml_html_parser {
   tree   finalize_space (tree t);
   // END NOTE
   bool build_valid_child (string parent, string child);
+  bool build_empty_tag (string tag);
   bool build_must_close (string tag);
   bool build_can_close (string tag);
   void build (tree& r);
@@ -106,8 +108,115 @@ string xml_unspace (string s, bool first, bool last);
 
 tree parse_xml (string s);
 
+// values of predefined entities, or NULL; s[0..n-1] is the name without '&;'
+const char* xml_entity_value (const char* s, int n);
+const char* html_entity_value (const char* s, int n);
+
+/******************************************************************************
+ * Streaming xml parser. Instead of tokenizing the whole input and building
+ * the tree afterwards, the input is read chunk by chunk and each element is
+ * reported to a consumer as soon as it is complete. Only the currently open
+ * elements and the pending unparsed input are kept in memory. Unclosed
+ * elements are closed at the end of the input and unmatched closing tags
+ * are ignored, in the same way as for parse_xml. In Html mode, empty tags
+ * and tags which cannot be nested are closed in the same way as parse_html
+ * does; the charset of the input should already be UTF-8.
+ ******************************************************************************/
+
+struct xml_consumer {
+  virtual ~xml_consumer () {}
+  // attrs is a tuple of ("attr" name) or ("attr" name value) tuples
+  virtual void start_element (string name, tree attrs)= 0;
+  virtual void end_element (string name)               = 0;
+  virtual void characters (string s)                   = 0;
+  virtual void cdata (string s) { characters (s); }
+  virtual void processing_instruction (string target, string data) {}
+  virtual void comment (string s) {}
+  virtual void doctype (string name) {}
+};
+
+struct xml_stream_parser {
+  xml_html_parser helper; // entity tables and the parsing of single tokens
+  xml_consumer&   out;
+  string          buf;
+  int             pos;
+  bool            is_cr;
+  array<string>   open;
+  int             scan;       // scanned part of an incomplete token
+  int             scan_depth; // state of the scan at that point
+  char            scan_quote;
+  char            scan_prev;
+
+  xml_stream_parser (xml_consumer& out, bool html= false);
+  void feed (string chunk);
+  void finish ();
+
+  int  token_end (bool last);
+  int  text_end (bool last);
+  void process_token (string token);
+  void process_text (string text);
+  void open_element (string name);
+  void pop_element ();
+  void close_element (string name);
+  void process (bool last);
+};
+
+struct xml_tree_builder : public xml_consumer {
+  array<tree> stack;
+  string      text;
+  bool        indexed; // whether elements are added to index while parsing
+  xml_index   index;
+
+  xml_tree_builder (bool indexed= false);
+  void flush ();
+  void start_element (string name, tree attrs);
+  void end_element (string name);
+  void characters (string s);
+  void cdata (string s);
+  void processing_instruction (string target, string data);
+  void comment (string s);
+  void doctype (string name);
+  tree result ();
+};
+
+void stream_xml (string s, xml_consumer& out, bool html= false);
+bool stream_xml_file (url u, xml_consumer& out, bool html= false);
+tree parse_xml_file (url u);
+
 tree   find_first_element_by_name (tree t, string name);
 string get_attr_from_element (tree t, string name, string default_value);
 int    parse_xml_length (string length);
 
+/******************************************************************************
+ * Index of a parsed xml tree for repeated queries. The elements of the tree
+ * are listed in document order by tag name and by attribute name, so that
+ * queries become lookups instead of walks over the whole tree. Attribute
+ * lists ("@" nodes) are not elements. The index refers to the subtrees of
+ * the tree and must be rebuilt when it changes. It can also be filled
+ * while parsing, see xml_tree_builder and parse_xml_index.
+ ******************************************************************************/
+
+struct xml_index_rep : concrete_struct {
+  tree                         root;
+  hashmap<string, array<tree>> by_name;
+  hashmap<string, array<tree>> by_attr;
+
+  xml_index_rep (tree t);
+  void add (tree t);
+  void add_element (tree t);
+  friend class xml_index;
+};
+
+class xml_index {
+  CONCRETE (xml_index);
+  xml_index (tree t= tree ()) : rep (tm_new<xml_index_rep> (t)) {}
+};
+CONCRETE_CODE (xml_index);
+
+tree        find_first_element_by_name (xml_index idx, string name);
+array<tree> find_elements_by_name (xml_index idx, string name);
+array<tree> find_elements_by_attr (xml_index idx, string attr);
+array<tree> find_elements_by_attr (xml_index idx, string attr, string value);
+xml_index   parse_xml_index (string s);
+
 #endif
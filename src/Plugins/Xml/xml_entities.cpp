@@ -0,0 +1,2451 @@
+
+/******************************************************************************
+ * MODULE     : xml_entities.cpp
+ * DESCRIPTION: perfect hash table of Html5 named entities
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+// This file is generated by xml_entities.py; do not edit it by hand.
+
+#include "xml.hpp"
+
+#include <string.h>
+
+#define N_HTML_ENTITIES 2125
+
+struct html_entity_entry {
+  const char* name;
+  const char* value;
+};
+
+static const html_entity_entry html_entity_table[N_HTML_ENTITIES]= {
+    {"SHcy", "\320\250"},
+    {"diamond", "\342\213\204"},
+    {"geq", "\342\211\245"},
+    {"dtri", "\342\226\277"},
+    {"succapprox", "\342\252\270"},
+    {"FilledVerySmallSquare", "\342\226\252"},
+    {"cwconint", "\342\210\262"},
+    {"Uopf", "\360\235\225\214"},
+    {"gescc", "\342\252\251"},
+    {"nvrArr", "\342\244\203"},
+    {"homtht", "\342\210\273"},
+    {"ZHcy", "\320\226"},
+    {"ropf", "\360\235\225\243"},
+    {"olcir", "\342\246\276"},
+    {"reals", "\342\204\235"},
+    {"ssetmn", "\342\210\226"},
+    {"infin", "\342\210\236"},
+    {"xsqcup", "\342\250\206"},
+    {"imacr", "\304\253"},
+    {"curarrm", "\342\244\274"},
+    {"Xfr", "\360\235\224\233"},
+    {"nearr", "\342\206\227"},
+    {"curren", "\302\244"},
+    {"GreaterTilde", "\342\211\263"},
+    {"NotRightTriangleBar", "\342\247\220\314\270"},
+    {"Rfr", "\342\204\234"},
+    {"nGtv", "\342\211\253\314\270"},
+    {"OverBracket", "\342\216\264"},
+    {"diams", "\342\231\246"},
+    {"lnE", "\342\211\250"},
+    {"boxh", "\342\224\200"},
+    {"frac23", "\342\205\224"},
+    {"nsucceq", "\342\252\260\314\270"},
+    {"RightTriangleBar", "\342\247\220"},
+    {"prec", "\342\211\272"},
+    {"asymp", "\342\211\210"},
+    {"gbreve", "\304\237"},
+    {"sung", "\342\231\252"},
+    {"weierp", "\342\204\230"},
+    {"vnsub", "\342\212\202\342\203\222"},
+    {"sqsupset", "\342\212\220"},
+    {"Lleftarrow", "\342\207\232"},
+    {"nang", "\342\210\240\342\203\222"},
+    {"omega", "\317\211"},
+    {"thorn", "\303\276"},
+    {"gammad", "\317\235"},
+    {"nvltrie", "\342\212\264\342\203\222"},
+    {"DoubleRightTee", "\342\212\250"},
+    {"NestedGreaterGreater", "\342\211\253"},
+    {"iinfin", "\342\247\234"},
+    {"NotSucceedsEqual", "\342\252\260\314\270"},
+    {"parsim", "\342\253\263"},
+    {"IEcy", "\320\225"},
+    {"frac45", "\342\205\230"},
+    {"nsube", "\342\212\210"},
+    {"larrlp", "\342\206\253"},
+    {"theta", "\316\270"},
+    {"utdot", "\342\213\260"},
+    {"NotSquareSubsetEqual", "\342\213\242"},
+    {"xopf", "\360\235\225\251"},
+    {"boxV", "\342\225\221"},
+    {"delta", "\316\264"},
+    {"measuredangle", "\342\210\241"},
+    {"ntriangleright", "\342\213\253"},
+    {"pluscir", "\342\250\242"},
+    {"lAarr", "\342\207\232"},
+    {"subsetneqq", "\342\253\213"},
+    {"sigma", "\317\203"},
+    {"boxDR", "\342\225\224"},
+    {"rarrhk", "\342\206\252"},
+    {"ne", "\342\211\240"},
+    {"num", "#"},
+    {"LowerLeftArrow", "\342\206\231"},
+    {"lpar", "("},
+    {"circleddash", "\342\212\235"},
+    {"gtreqqless", "\342\252\214"},
+    {"dscr", "\360\235\222\271"},
+    {"ring", "\313\232"},
+    {"Zdot", "\305\273"},
+    {"phi", "\317\206"},
+    {"esdot", "\342\211\220"},
+    {"CenterDot", "\302\267"},
+    {"backprime", "\342\200\265"},
+    {"fnof", "\306\222"},
+    {"quaternions", "\342\204\215"},
+    {"Ncedil", "\305\205"},
+    {"grave", "`"},
+    {"CircleTimes", "\342\212\227"},
+    {"preceq", "\342\252\257"},
+    {"Gcirc", "\304\234"},
+    {"Eogon", "\304\230"},
+    {"dtdot", "\342\213\261"},
+    {"loang", "\342\237\254"},
+    {"afr", "\360\235\224\236"},
+    {"ycy", "\321\213"},
+    {"VerticalTilde", "\342\211\200"},
+    {"gdot", "\304\241"},
+    {"Pcy", "\320\237"},
+    {"precapprox", "\342\252\267"},
+    {"TildeEqual", "\342\211\203"},
+    {"hardcy", "\321\212"},
+    {"ocy", "\320\276"},
+    {"zeetrf", "\342\204\250"},
+    {"female", "\342\231\200"},
+    {"NotLessEqual", "\342\211\260"},
+    {"race", "\342\210\275\314\261"},
+    {"downharpoonright", "\342\207\202"},
+    {"atilde", "\303\243"},
+    {"real", "\342\204\234"},
+    {"eng", "\305\213"},
+    {"Scaron", "\305\240"},
+    {"ltdot", "\342\213\226"},
+    {"lrcorner", "\342\214\237"},
+    {"apE", "\342\251\260"},
+    {"mapstodown", "\342\206\247"},
+    {"Eopf", "\360\235\224\274"},
+    {"els", "\342\252\225"},
+    {"ffilig", "\357\254\203"},
+    {"blacktriangleleft", "\342\227\202"},
+    {"eqslantgtr", "\342\252\226"},
+    {"nsupE", "\342\253\206\314\270"},
+    {"tint", "\342\210\255"},
+    {"supplus", "\342\253\200"},
+    {"Fscr", "\342\204\261"},
+    {"tscr", "\360\235\223\211"},
+    {"Vert", "\342\200\226"},
+    {"Vvdash", "\342\212\252"},
+    {"tstrok", "\305\247"},
+    {"lstrok", "\305\202"},
+    {"THORN", "\303\236"},
+    {"Vopf", "\360\235\225\215"},
+    {"looparrowleft", "\342\206\253"},
+    {"Zopf", "\342\204\244"},
+    {"lharul", "\342\245\252"},
+    {"bigtriangleup", "\342\226\263"},
+    {"NotSucceeds", "\342\212\201"},
+    {"bne", "=\342\203\245"},
+    {"agrave", "\303\240"},
+    {"gesl", "\342\213\233\357\270\200"},
+    {"kgreen", "\304\270"},
+    {"ReverseElement", "\342\210\213"},
+    {"Conint", "\342\210\257"},
+    {"Uuml", "\303\234"},
+    {"Zcaron", "\305\275"},
+    {"colon", ":"},
+    {"Vcy", "\320\222"},
+    {"uArr", "\342\207\221"},
+    {"triangledown", "\342\226\277"},
+    {"vrtri", "\342\212\263"},
+    {"GreaterEqualLess", "\342\213\233"},
+    {"qprime", "\342\201\227"},
+    {"isin", "\342\210\210"},
+    {"Larr", "\342\206\236"},
+    {"Uogon", "\305\262"},
+    {"Otimes", "\342\250\267"},
+    {"le", "\342\211\244"},
+    {"Dopf", "\360\235\224\273"},
+    {"lg", "\342\211\266"},
+    {"RightDownVector", "\342\207\202"},
+    {"OpenCurlyDoubleQuote", "\342\200\234"},
+    {"lvertneqq", "\342\211\250\357\270\200"},
+    {"lcy", "\320\273"},
+    {"SOFTcy", "\320\254"},
+    {"lobrk", "\342\237\246"},
+    {"rcy", "\321\200"},
+    {"ll", "\342\211\252"},
+    {"Zcy", "\320\227"},
+    {"lnap", "\342\252\211"},
+    {"pr", "\342\211\272"},
+    {"frac12", "\302\275"},
+    {"NotSucceedsTilde", "\342\211\277\314\270"},
+    {"permil", "\342\200\260"},
+    {"lmidot", "\305\200"},
+    {"Proportion", "\342\210\267"},
+    {"oast", "\342\212\233"},
+    {"lowbar", "_"},
+    {"NotReverseElement", "\342\210\214"},
+    {"frac14", "\302\274"},
+    {"frac15", "\342\205\225"},
+    {"boxur", "\342\224\224"},
+    {"frac13", "\342\205\223"},
+    {"flat", "\342\231\255"},
+    {"dstrok", "\304\221"},
+    {"dotminus", "\342\210\270"},
+    {"mid", "\342\210\243"},
+    {"VDash", "\342\212\253"},
+    {"NegativeVeryThinSpace", "\342\200\213"},
+    {"Iukcy", "\320\206"},
+    {"dfisht", "\342\245\277"},
+    {"frac18", "\342\205\233"},
+    {"lrm", "\342\200\216"},
+    {"rightleftharpoons", "\342\207\214"},
+    {"hellip", "\342\200\246"},
+    {"notnivb", "\342\213\276"},
+    {"eplus", "\342\251\261"},
+    {"capcap", "\342\251\213"},
+    {"cupor", "\342\251\205"},
+    {"vellip", "\342\213\256"},
+    {"OpenCurlyQuote", "\342\200\230"},
+    {"hairsp", "\342\200\212"},
+    {"roang", "\342\237\255"},
+    {"varr", "\342\206\225"},
+    {"imof", "\342\212\267"},
+    {"Qfr", "\360\235\224\224"},
+    {"leq", "\342\211\244"},
+    {"imagline", "\342\204\220"},
+    {"tbrk", "\342\216\264"},
+    {"DownLeftTeeVector", "\342\245\236"},
+    {"macr", "\302\257"},
+    {"eqslantless", "\342\252\225"},
+    {"ddarr", "\342\207\212"},
+    {"DownTeeArrow", "\342\206\247"},
+    {"napos", "\305\211"},
+    {"Because", "\342\210\265"},
+    {"swarr", "\342\206\231"},
+    {"tridot", "\342\227\254"},
+    {"RuleDelayed", "\342\247\264"},
+    {"ClockwiseContourIntegral", "\342\210\262"},
+    {"lopar", "\342\246\205"},
+    {"pre", "\342\252\257"},
+    {"varsupsetneq", "\342\212\213\357\270\200"},
+    {"Topf", "\360\235\225\213"},
+    {"Dagger", "\342\200\241"},
+    {"straightphi", "\317\225"},
+    {"MediumSpace", "\342\201\237"},
+    {"questeq", "\342\211\237"},
+    {"andslope", "\342\251\230"},
+    {"LeftUpTeeVector", "\342\245\240"},
+    {"sharp", "\342\231\257"},
+    {"supsetneq", "\342\212\213"},
+    {"Leftrightarrow", "\342\207\224"},
+    {"TSHcy", "\320\213"},
+    {"deg", "\302\260"},
+    {"hslash", "\342\204\217"},
+    {"scE", "\342\252\264"},
+    {"trianglerighteq", "\342\212\265"},
+    {"doteq", "\342\211\220"},
+    {"uHar", "\342\245\243"},
+    {"imath", "\304\261"},
+    {"DoubleLeftTee", "\342\253\244"},
+    {"epsiv", "\317\265"},
+    {"Alpha", "\316\221"},
+    {"thetasym", "\317\221"},
+    {"nvHarr", "\342\244\204"},
+    {"supseteqq", "\342\253\206"},
+    {"smile", "\342\214\243"},
+    {"ulcrop", "\342\214\217"},
+    {"subsub", "\342\253\225"},
+    {"lesseqqgtr", "\342\252\213"},
+    {"Yfr", "\360\235\224\234"},
+    {"VerticalSeparator", "\342\235\230"},
+    {"nLeftrightarrow", "\342\207\216"},
+    {"efr", "\360\235\224\242"},
+    {"geqslant", "\342\251\276"},
+    {"dsol", "\342\247\266"},
+    {"lne", "\342\252\207"},
+    {"iogon", "\304\257"},
+    {"iscr", "\360\235\222\276"},
+    {"rtrif", "\342\226\270"},
+    {"hyphen", "\342\200\220"},
+    {"lotimes", "\342\250\264"},
+    {"Abreve", "\304\202"},
+    {"gvnE", "\342\211\251\357\270\200"},
+    {"dopf", "\360\235\225\225"},
+    {"thetav", "\317\221"},
+    {"lsquor", "\342\200\232"},
+    {"sfrown", "\342\214\242"},
+    {"LowerRightArrow", "\342\206\230"},
+    {"lnapprox", "\342\252\211"},
+    {"ldrushar", "\342\245\213"},
+    {"vnsup", "\342\212\203\342\203\222"},
+    {"lessapprox", "\342\252\205"},
+    {"cirmid", "\342\253\257"},
+    {"integers", "\342\204\244"},
+    {"rlarr", "\342\207\204"},
+    {"xrarr", "\342\237\266"},
+    {"robrk", "\342\237\247"},
+    {"HilbertSpace", "\342\204\213"},
+    {"Sub", "\342\213\220"},
+    {"xwedge", "\342\213\200"},
+    {"NotLessSlantEqual", "\342\251\275\314\270"},
+    {"notin", "\342\210\211"},
+    {"vartheta", "\317\221"},
+    {"prime", "\342\200\262"},
+    {"DownArrow", "\342\206\223"},
+    {"succnsim", "\342\213\251"},
+    {"iquest", "\302\277"},
+    {"longleftrightarrow", "\342\237\267"},
+    {"neArr", "\342\207\227"},
+    {"lesdotor", "\342\252\203"},
+    {"cedil", "\302\270"},
+    {"boxDr", "\342\225\223"},
+    {"diam", "\342\213\204"},
+    {"dscy", "\321\225"},
+    {"Mellintrf", "\342\204\263"},
+    {"toea", "\342\244\250"},
+    {"lEg", "\342\252\213"},
+    {"larr", "\342\206\220"},
+    {"sum", "\342\210\221"},
+    {"CloseCurlyDoubleQuote", "\342\200\235"},
+    {"scy", "\321\201"},
+    {"nless", "\342\211\256"},
+    {"puncsp", "\342\200\210"},
+    {"boxhd", "\342\224\254"},
+    {"awint", "\342\250\221"},
+    {"late", "\342\252\255"},
+    {"tosa", "\342\244\251"},
+    {"divide", "\303\267"},
+    {"rtimes", "\342\213\212"},
+    {"Cdot", "\304\212"},
+    {"spadesuit", "\342\231\240"},
+    {"Backslash", "\342\210\226"},
+    {"icirc", "\303\256"},
+    {"CupCap", "\342\211\215"},
+    {"ordm", "\302\272"},
+    {"Updownarrow", "\342\207\225"},
+    {"apacir", "\342\251\257"},
+    {"Cup", "\342\213\223"},
+    {"rAtail", "\342\244\234"},
+    {"Omicron", "\316\237"},
+    {"gtrsim", "\342\211\263"},
+    {"gtrless", "\342\211\267"},
+    {"nesear", "\342\244\250"},
+    {"ccupssm", "\342\251\220"},
+    {"Longleftarrow", "\342\237\270"},
+    {"circledcirc", "\342\212\232"},
+    {"orv", "\342\251\233"},
+    {"squarf", "\342\226\252"},
+    {"Bumpeq", "\342\211\216"},
+    {"cirfnint", "\342\250\220"},
+    {"varnothing", "\342\210\205"},
+    {"DoubleRightArrow", "\342\207\222"},
+    {"vangrt", "\342\246\234"},
+    {"minusdu", "\342\250\252"},
+    {"Wopf", "\360\235\225\216"},
+    {"cudarrr", "\342\244\265"},
+    {"ccedil", "\303\247"},
+    {"bumpeq", "\342\211\217"},
+    {"nsubseteqq", "\342\253\205\314\270"},
+    {"Uring", "\305\256"},
+    {"bcong", "\342\211\214"},
+    {"NewLine", "\012"},
+    {"awconint", "\342\210\263"},
+    {"subne", "\342\212\212"},
+    {"Ncaron", "\305\207"},
+    {"mapsto", "\342\206\246"},
+    {"nfr", "\360\235\224\253"},
+    {"solb", "\342\247\204"},
+    {"Ocirc", "\303\224"},
+    {"boxDL", "\342\225\227"},
+    {"vprop", "\342\210\235"},
+    {"Longleftrightarrow", "\342\237\272"},
+    {"Rarr", "\342\206\240"},
+    {"ecy", "\321\215"},
+    {"xlarr", "\342\237\265"},
+    {"iocy", "\321\221"},
+    {"rang", "\342\237\251"},
+    {"lozf", "\342\247\253"},
+    {"Kappa", "\316\232"},
+    {"Nu", "\316\235"},
+    {"nearrow", "\342\206\227"},
+    {"minusd", "\342\210\270"},
+    {"DotEqual", "\342\211\220"},
+    {"pfr", "\360\235\224\255"},
+    {"Chi", "\316\247"},
+    {"rcub", "}"},
+    {"NotExists", "\342\210\204"},
+    {"DoubleDot", "\302\250"},
+    {"Lopf", "\360\235\225\203"},
+    {"ruluhar", "\342\245\250"},
+    {"nleqslant", "\342\251\275\314\270"},
+    {"ee", "\342\205\207"},
+    {"emsp", "\342\200\203"},
+    {"SuchThat", "\342\210\213"},
+    {"udarr", "\342\207\205"},
+    {"percnt", "%"},
+    {"DoubleLongLeftArrow", "\342\237\270"},
+    {"ExponentialE", "\342\205\207"},
+    {"odblac", "\305\221"},
+    {"circlearrowleft", "\342\206\272"},
+    {"nesim", "\342\211\202\314\270"},
+    {"seArr", "\342\207\230"},
+    {"subedot", "\342\253\203"},
+    {"dtrif", "\342\226\276"},
+    {"Xi", "\316\236"},
+    {"subnE", "\342\253\213"},
+    {"LeftTeeArrow", "\342\206\244"},
+    {"angmsdag", "\342\246\256"},
+    {"lvnE", "\342\211\250\357\270\200"},
+    {"Ograve", "\303\222"},
+    {"prap", "\342\252\267"},
+    {"Jscr", "\360\235\222\245"},
+    {"Sqrt", "\342\210\232"},
+    {"urcrop", "\342\214\216"},
+    {"quatint", "\342\250\226"},
+    {"primes", "\342\204\231"},
+    {"larrpl", "\342\244\271"},
+    {"csupe", "\342\253\222"},
+    {"plusmn", "\302\261"},
+    {"zwnj", "\342\200\214"},
+    {"AElig", "\303\206"},
+    {"backsim", "\342\210\275"},
+    {"ntilde", "\303\261"},
+    {"Ecy", "\320\255"},
+    {"sopf", "\360\235\225\244"},
+    {"Bfr", "\360\235\224\205"},
+    {"UnderBrace", "\342\217\237"},
+    {"rdquo", "\342\200\235"},
+    {"Mu", "\316\234"},
+    {"NotGreaterEqual", "\342\211\261"},
+    {"vert", "|"},
+    {"Sigma", "\316\243"},
+    {"Rcaron", "\305\230"},
+    {"NotCupCap", "\342\211\255"},
+    {"operp", "\342\246\271"},
+    {"zopf", "\360\235\225\253"},
+    {"InvisibleTimes", "\342\201\242"},
+    {"vscr", "\360\235\223\213"},
+    {"rationals", "\342\204\232"},
+    {"thkap", "\342\211\210"},
+    {"dbkarow", "\342\244\217"},
+    {"nvge", "\342\211\245\342\203\222"},
+    {"lrtri", "\342\212\277"},
+    {"daleth", "\342\204\270"},
+    {"NotRightTriangleEqual", "\342\213\255"},
+    {"nLl", "\342\213\230\314\270"},
+    {"CapitalDifferentialD", "\342\205\205"},
+    {"LongLeftRightArrow", "\342\237\267"},
+    {"gtrdot", "\342\213\227"},
+    {"Zscr", "\360\235\222\265"},
+    {"empty", "\342\210\205"},
+    {"rbrkslu", "\342\246\220"},
+    {"lopf", "\360\235\225\235"},
+    {"ApplyFunction", "\342\201\241"},
+    {"searrow", "\342\206\230"},
+    {"zfr", "\360\235\224\267"},
+    {"Hscr", "\342\204\213"},
+    {"NotGreaterGreater", "\342\211\253\314\270"},
+    {"rmoust", "\342\216\261"},
+    {"UpperLeftArrow", "\342\206\226"},
+    {"udhar", "\342\245\256"},
+    {"lbrack", "["},
+    {"ulcorn", "\342\214\234"},
+    {"Qopf", "\342\204\232"},
+    {"Jcirc", "\304\264"},
+    {"nacute", "\305\204"},
+    {"npar", "\342\210\246"},
+    {"nGg", "\342\213\231\314\270"},
+    {"fpartint", "\342\250\215"},
+    {"erDot", "\342\211\223"},
+    {"lesdot", "\342\251\277"},
+    {"succneqq", "\342\252\266"},
+    {"emptyv", "\342\210\205"},
+    {"pitchfork", "\342\213\224"},
+    {"VeryThinSpace", "\342\200\212"},
+    {"lscr", "\360\235\223\201"},
+    {"rangle", "\342\237\251"},
+    {"Ucy", "\320\243"},
+    {"tau", "\317\204"},
+    {"OverBar", "\342\200\276"},
+    {"exponentiale", "\342\205\207"},
+    {"Ccedil", "\303\207"},
+    {"utilde", "\305\251"},
+    {"LeftAngleBracket", "\342\237\250"},
+    {"rarr", "\342\206\222"},
+    {"Esim", "\342\251\263"},
+    {"LeftTriangleBar", "\342\247\217"},
+    {"ltri", "\342\227\203"},
+    {"blacktriangleright", "\342\226\270"},
+    {"ShortDownArrow", "\342\206\223"},
+    {"gEl", "\342\252\214"},
+    {"upsi", "\317\205"},
+    {"curlywedge", "\342\213\217"},
+    {"IOcy", "\320\201"},
+    {"nsubseteq", "\342\212\210"},
+    {"timesbar", "\342\250\261"},
+    {"amacr", "\304\201"},
+    {"NotSubset", "\342\212\202\342\203\222"},
+    {"Map", "\342\244\205"},
+    {"UnderBar", "_"},
+    {"cong", "\342\211\205"},
+    {"RightUpDownVector", "\342\245\217"},
+    {"lfr", "\360\235\224\251"},
+    {"gtquest", "\342\251\274"},
+    {"half", "\302\275"},
+    {"REG", "\302\256"},
+    {"nvlArr", "\342\244\202"},
+    {"frac38", "\342\205\234"},
+    {"straightepsilon", "\317\265"},
+    {"eacute", "\303\251"},
+    {"RightFloor", "\342\214\213"},
+    {"LJcy", "\320\211"},
+    {"ffllig", "\357\254\204"},
+    {"divonx", "\342\213\207"},
+    {"gnsim", "\342\213\247"},
+    {"nltrie", "\342\213\254"},
+    {"Rscr", "\342\204\233"},
+    {"Fouriertrf", "\342\204\261"},
+    {"Agrave", "\303\200"},
+    {"aring", "\303\245"},
+    {"DoubleLeftArrow", "\342\207\220"},
+    {"boxHd", "\342\225\244"},
+    {"LeftDownVectorBar", "\342\245\231"},
+    {"ltlarr", "\342\245\266"},
+    {"subdot", "\342\252\275"},
+    {"Icy", "\320\230"},
+    {"shcy", "\321\210"},
+    {"Ycy", "\320\253"},
+    {"LongLeftArrow", "\342\237\265"},
+    {"LeftDownTeeVector", "\342\245\241"},
+    {"qopf", "\360\235\225\242"},
+    {"NotLeftTriangle", "\342\213\252"},
+    {"ohbar", "\342\246\265"},
+    {"ocirc", "\303\264"},
+    {"shortmid", "\342\210\243"},
+    {"parsl", "\342\253\275"},
+    {"Star", "\342\213\206"},
+    {"target", "\342\214\226"},
+    {"Xscr", "\360\235\222\263"},
+    {"wfr", "\360\235\224\264"},
+    {"urtri", "\342\227\271"},
+    {"lagran", "\342\204\222"},
+    {"ngsim", "\342\211\265"},
+    {"sube", "\342\212\206"},
+    {"rdca", "\342\244\267"},
+    {"supnE", "\342\253\214"},
+    {"upsih", "\317\222"},
+    {"Igrave", "\303\214"},
+    {"sol", "/"},
+    {"RightDownVectorBar", "\342\245\225"},
+    {"varphi", "\317\225"},
+    {"Dashv", "\342\253\244"},
+    {"Omega", "\316\251"},
+    {"simgE", "\342\252\240"},
+    {"aacute", "\303\241"},
+    {"tcedil", "\305\243"},
+    {"subseteq", "\342\212\206"},
+    {"ordf", "\302\252"},
+    {"ape", "\342\211\212"},
+    {"Oslash", "\303\230"},
+    {"setminus", "\342\210\226"},
+    {"approx", "\342\211\210"},
+    {"trianglelefteq", "\342\212\264"},
+    {"angmsdaf", "\342\246\255"},
+    {"isindot", "\342\213\265"},
+    {"DoubleUpArrow", "\342\207\221"},
+    {"rBarr", "\342\244\217"},
+    {"hbar", "\342\204\217"},
+    {"boxH", "\342\225\220"},
+    {"Delta", "\316\224"},
+    {"vfr", "\360\235\224\263"},
+    {"topf", "\360\235\225\245"},
+    {"HARDcy", "\320\252"},
+    {"bnot", "\342\214\220"},
+    {"boxVH", "\342\225\254"},
+    {"yfr", "\360\235\224\266"},
+    {"nsimeq", "\342\211\204"},
+    {"rightrightarrows", "\342\207\211"},
+    {"varsigma", "\317\202"},
+    {"SucceedsEqual", "\342\252\260"},
+    {"boxVR", "\342\225\240"},
+    {"uogon", "\305\263"},
+    {"hercon", "\342\212\271"},
+    {"boxtimes", "\342\212\240"},
+    {"Mfr", "\360\235\224\220"},
+    {"angrtvbd", "\342\246\235"},
+    {"gtcir", "\342\251\272"},
+    {"gjcy", "\321\223"},
+    {"plustwo", "\342\250\247"},
+    {"rsaquo", "\342\200\272"},
+    {"Kcedil", "\304\266"},
+    {"comma", ","},
+    {"equest", "\342\211\237"},
+    {"Uarrocir", "\342\245\211"},
+    {"Atilde", "\303\203"},
+    {"ltcir", "\342\251\271"},
+    {"IJlig", "\304\262"},
+    {"OverParenthesis", "\342\217\234"},
+    {"gtlPar", "\342\246\225"},
+    {"downarrow", "\342\206\223"},
+    {"nsce", "\342\252\260\314\270"},
+    {"perp", "\342\212\245"},
+    {"Lacute", "\304\271"},
+    {"elsdot", "\342\252\227"},
+    {"Nfr", "\360\235\224\221"},
+    {"ofcir", "\342\246\277"},
+    {"lescc", "\342\252\250"},
+    {"LeftRightArrow", "\342\206\224"},
+    {"uarr", "\342\206\221"},
+    {"nexist", "\342\210\204"},
+    {"capdot", "\342\251\200"},
+    {"precnsim", "\342\213\250"},
+    {"Zeta", "\316\226"},
+    {"larrsim", "\342\245\263"},
+    {"xfr", "\360\235\224\265"},
+    {"NotNestedGreaterGreater", "\342\252\242\314\270"},
+    {"oelig", "\305\223"},
+    {"egs", "\342\252\226"},
+    {"tcaron", "\305\245"},
+    {"Pi", "\316\240"},
+    {"rarrw", "\342\206\235"},
+    {"TildeTilde", "\342\211\210"},
+    {"LeftTriangle", "\342\212\262"},
+    {"Prime", "\342\200\263"},
+    {"lesssim", "\342\211\262"},
+    {"NotGreater", "\342\211\257"},
+    {"nsmid", "\342\210\244"},
+    {"lfloor", "\342\214\212"},
+    {"rscr", "\360\235\223\207"},
+    {"mapstoup", "\342\206\245"},
+    {"UpArrowBar", "\342\244\222"},
+    {"midcir", "\342\253\260"},
+    {"quot", "\""},
+    {"Ycirc", "\305\266"},
+    {"Gt", "\342\211\253"},
+    {"xoplus", "\342\250\201"},
+    {"bigstar", "\342\230\205"},
+    {"cuvee", "\342\213\216"},
+    {"supsetneqq", "\342\253\214"},
+    {"varkappa", "\317\260"},
+    {"GreaterFullEqual", "\342\211\247"},
+    {"VerticalBar", "\342\210\243"},
+    {"frown", "\342\214\242"},
+    {"rarrc", "\342\244\263"},
+    {"rarrb", "\342\207\245"},
+    {"raquo", "\302\273"},
+    {"ngeqq", "\342\211\247\314\270"},
+    {"Cscr", "\360\235\222\236"},
+    {"ntlg", "\342\211\270"},
+    {"nvsim", "\342\210\274\342\203\222"},
+    {"zcy", "\320\267"},
+    {"DownLeftVectorBar", "\342\245\226"},
+    {"NotPrecedes", "\342\212\200"},
+    {"Gg", "\342\213\231"},
+    {"UnderParenthesis", "\342\217\235"},
+    {"PlusMinus", "\302\261"},
+    {"NotEqualTilde", "\342\211\202\314\270"},
+    {"nbsp", "\302\240"},
+    {"sim", "\342\210\274"},
+    {"nlsim", "\342\211\264"},
+    {"SubsetEqual", "\342\212\206"},
+    {"LessFullEqual", "\342\211\246"},
+    {"quest", "?"},
+    {"Euml", "\303\213"},
+    {"triangleq", "\342\211\234"},
+    {"iopf", "\360\235\225\232"},
+    {"GT", ">"},
+    {"forkv", "\342\253\231"},
+    {"iecy", "\320\265"},
+    {"TildeFullEqual", "\342\211\205"},
+    {"cross", "\342\234\227"},
+    {"sup2", "\302\262"},
+    {"sup3", "\302\263"},
+    {"pluse", "\342\251\262"},
+    {"Imacr", "\304\252"},
+    {"ffr", "\360\235\224\243"},
+    {"Colone", "\342\251\264"},
+    {"trisb", "\342\247\215"},
+    {"rfisht", "\342\245\275"},
+    {"angmsdae", "\342\246\254"},
+    {"nsupseteqq", "\342\253\206\314\270"},
+    {"bigotimes", "\342\250\202"},
+    {"Jcy", "\320\231"},
+    {"because", "\342\210\265"},
+    {"Wscr", "\360\235\222\262"},
+    {"rx", "\342\204\236"},
+    {"leftrightarrow", "\342\206\224"},
+    {"rharu", "\342\207\200"},
+    {"ctdot", "\342\213\257"},
+    {"lurdshar", "\342\245\212"},
+    {"bowtie", "\342\213\210"},
+    {"EmptyVerySmallSquare", "\342\226\253"},
+    {"GreaterGreater", "\342\252\242"},
+    {"curvearrowright", "\342\206\267"},
+    {"boxUL", "\342\225\235"},
+    {"Wfr", "\360\235\224\232"},
+    {"Nacute", "\305\203"},
+    {"kscr", "\360\235\223\200"},
+    {"dHar", "\342\245\245"},
+    {"kopf", "\360\235\225\234"},
+    {"iff", "\342\207\224"},
+    {"precsim", "\342\211\276"},
+    {"nLt", "\342\211\252\342\203\222"},
+    {"andand", "\342\251\225"},
+    {"acirc", "\303\242"},
+    {"LeftDoubleBracket", "\342\237\246"},
+    {"jscr", "\360\235\222\277"},
+    {"uring", "\305\257"},
+    {"copf", "\360\235\225\224"},
+    {"rdldhar", "\342\245\251"},
+    {"Gbreve", "\304\236"},
+    {"DoubleDownArrow", "\342\207\223"},
+    {"dollar", "$"},
+    {"Not", "\342\253\254"},
+    {"DD", "\342\205\205"},
+    {"SquareSubset", "\342\212\217"},
+    {"NotVerticalBar", "\342\210\244"},
+    {"dzigrarr", "\342\237\277"},
+    {"fork", "\342\213\224"},
+    {"sqsub", "\342\212\217"},
+    {"mfr", "\360\235\224\252"},
+    {"Del", "\342\210\207"},
+    {"NotTildeFullEqual", "\342\211\207"},
+    {"NotPrecedesEqual", "\342\252\257\314\270"},
+    {"SupersetEqual", "\342\212\207"},
+    {"uopf", "\360\235\225\246"},
+    {"qfr", "\360\235\224\256"},
+    {"aelig", "\303\246"},
+    {"Icirc", "\303\216"},
+    {"gsim", "\342\211\263"},
+    {"map", "\342\206\246"},
+    {"eparsl", "\342\247\243"},
+    {"wreath", "\342\211\200"},
+    {"zcaron", "\305\276"},
+    {"LongRightArrow", "\342\237\266"},
+    {"boxVl", "\342\225\242"},
+    {"GreaterLess", "\342\211\267"},
+    {"heartsuit", "\342\231\245"},
+    {"lbrace", "{"},
+    {"omicron", "\316\277"},
+    {"xlArr", "\342\237\270"},
+    {"Rcedil", "\305\226"},
+    {"nrtri", "\342\213\253"},
+    {"lesdoto", "\342\252\201"},
+    {"boxDl", "\342\225\226"},
+    {"Equilibrium", "\342\207\214"},
+    {"Rcy", "\320\240"},
+    {"oror", "\342\251\226"},
+    {"DownBreve", "\314\221"},
+    {"MinusPlus", "\342\210\223"},
+    {"jsercy", "\321\230"},
+    {"Sopf", "\360\235\225\212"},
+    {"PrecedesTilde", "\342\211\276"},
+    {"darr", "\342\206\223"},
+    {"tprime", "\342\200\264"},
+    {"Uarr", "\342\206\237"},
+    {"lharu", "\342\206\274"},
+    {"UpperRightArrow", "\342\206\227"},
+    {"euro", "\342\202\254"},
+    {"supsup", "\342\253\226"},
+    {"plusb", "\342\212\236"},
+    {"nsubE", "\342\253\205\314\270"},
+    {"rsquor", "\342\200\231"},
+    {"Fcy", "\320\244"},
+    {"biguplus", "\342\250\204"},
+    {"cire", "\342\211\227"},
+    {"Iuml", "\303\217"},
+    {"omacr", "\305\215"},
+    {"larrbfs", "\342\244\237"},
+    {"epsilon", "\316\265"},
+    {"image", "\342\204\221"},
+    {"rarrbfs", "\342\244\240"},
+    {"boxUl", "\342\225\234"},
+    {"NotHumpEqual", "\342\211\217\314\270"},
+    {"boxhD", "\342\225\245"},
+    {"dArr", "\342\207\223"},
+    {"Qscr", "\360\235\222\254"},
+    {"supsub", "\342\253\224"},
+    {"NotTildeEqual", "\342\211\204"},
+    {"nleqq", "\342\211\246\314\270"},
+    {"wedge", "\342\210\247"},
+    {"risingdotseq", "\342\211\223"},
+    {"phone", "\342\230\216"},
+    {"nldr", "\342\200\245"},
+    {"isinsv", "\342\213\263"},
+    {"pcy", "\320\277"},
+    {"subseteqq", "\342\253\205"},
+    {"rightharpoondown", "\342\207\201"},
+    {"lhard", "\342\206\275"},
+    {"larrhk", "\342\206\251"},
+    {"Coproduct", "\342\210\220"},
+    {"npolint", "\342\250\224"},
+    {"zdot", "\305\274"},
+    {"nscr", "\360\235\223\203"},
+    {"nlArr", "\342\207\215"},
+    {"Iscr", "\342\204\220"},
+    {"epsi", "\316\265"},
+    {"nwarhk", "\342\244\243"},
+    {"subsup", "\342\253\223"},
+    {"varrho", "\317\261"},
+    {"curlyvee", "\342\213\216"},
+    {"rtrie", "\342\212\265"},
+    {"nbumpe", "\342\211\217\314\270"},
+    {"RightTeeVector", "\342\245\233"},
+    {"boxhU", "\342\225\250"},
+    {"curlyeqprec", "\342\213\236"},
+    {"nparsl", "\342\253\275\342\203\245"},
+    {"lneq", "\342\252\207"},
+    {"blank", "\342\220\243"},
+    {"Dscr", "\360\235\222\237"},
+    {"mopf", "\360\235\225\236"},
+    {"equals", "="},
+    {"square", "\342\226\241"},
+    {"nabla", "\342\210\207"},
+    {"CircleMinus", "\342\212\226"},
+    {"Wcirc", "\305\264"},
+    {"DownRightTeeVector", "\342\245\237"},
+    {"triangleright", "\342\226\271"},
+    {"tilde", "\313\234"},
+    {"Mscr", "\342\204\263"},
+    {"DoubleLongLeftRightArrow", "\342\237\272"},
+    {"bopf", "\360\235\225\223"},
+    {"rnmid", "\342\253\256"},
+    {"RightTee", "\342\212\242"},
+    {"rcaron", "\305\231"},
+    {"GreaterEqual", "\342\211\245"},
+    {"csub", "\342\253\217"},
+    {"vsubnE", "\342\253\213\357\270\200"},
+    {"pscr", "\360\235\223\205"},
+    {"wopf", "\360\235\225\250"},
+    {"Lfr", "\360\235\224\217"},
+    {"it", "\342\201\242"},
+    {"hearts", "\342\231\245"},
+    {"gsime", "\342\252\216"},
+    {"ofr", "\360\235\224\254"},
+    {"angle", "\342\210\240"},
+    {"tdot", "\342\203\233"},
+    {"dfr", "\360\235\224\241"},
+    {"yen", "\302\245"},
+    {"multimap", "\342\212\270"},
+    {"Lcy", "\320\233"},
+    {"ngeq", "\342\211\261"},
+    {"crarr", "\342\206\265"},
+    {"ljcy", "\321\231"},
+    {"csup", "\342\253\220"},
+    {"vBar", "\342\253\250"},
+    {"Cacute", "\304\206"},
+    {"kappav", "\317\260"},
+    {"gneq", "\342\252\210"},
+    {"Sscr", "\360\235\222\256"},
+    {"ocir", "\342\212\232"},
+    {"brvbar", "\302\246"},
+    {"uwangle", "\342\246\247"},
+    {"Square", "\342\226\241"},
+    {"ltrie", "\342\212\264"},
+    {"planck", "\342\204\217"},
+    {"cups", "\342\210\252\357\270\200"},
+    {"Im", "\342\204\221"},
+    {"supmult", "\342\253\202"},
+    {"utrif", "\342\226\264"},
+    {"ges", "\342\251\276"},
+    {"emptyset", "\342\210\205"},
+    {"curlyeqsucc", "\342\213\237"},
+    {"ord", "\342\251\235"},
+    {"nrarrw", "\342\206\235\314\270"},
+    {"profalar", "\342\214\256"},
+    {"NegativeThinSpace", "\342\200\213"},
+    {"Equal", "\342\251\265"},
+    {"iiint", "\342\210\255"},
+    {"nhpar", "\342\253\262"},
+    {"Pscr", "\360\235\222\253"},
+    {"there4", "\342\210\264"},
+    {"jmath", "\310\267"},
+    {"UnderBracket", "\342\216\265"},
+    {"nvinfin", "\342\247\236"},
+    {"lesg", "\342\213\232\357\270\200"},
+    {"DiacriticalDot", "\313\231"},
+    {"imagpart", "\342\204\221"},
+    {"vsubne", "\342\212\212\357\270\200"},
+    {"wscr", "\360\235\223\214"},
+    {"LeftTeeVector", "\342\245\232"},
+    {"chi", "\317\207"},
+    {"leftrightarrows", "\342\207\206"},
+    {"sqcaps", "\342\212\223\357\270\200"},
+    {"forall", "\342\210\200"},
+    {"bsime", "\342\213\215"},
+    {"caps", "\342\210\251\357\270\200"},
+    {"top", "\342\212\244"},
+    {"Hfr", "\342\204\214"},
+    {"rtri", "\342\226\271"},
+    {"cirscir", "\342\247\202"},
+    {"nrarrc", "\342\244\263\314\270"},
+    {"vsupne", "\342\212\213\357\270\200"},
+    {"nLtv", "\342\211\252\314\270"},
+    {"lesseqgtr", "\342\213\232"},
+    {"nLeftarrow", "\342\207\215"},
+    {"notinvb", "\342\213\267"},
+    {"ucirc", "\303\273"},
+    {"NotPrecedesSlantEqual", "\342\213\240"},
+    {"jcy", "\320\271"},
+    {"Ecirc", "\303\212"},
+    {"gesles", "\342\252\224"},
+    {"ecaron", "\304\233"},
+    {"Aogon", "\304\204"},
+    {"clubsuit", "\342\231\243"},
+    {"rlm", "\342\200\217"},
+    {"urcorner", "\342\214\235"},
+    {"Sup", "\342\213\221"},
+    {"aogon", "\304\205"},
+    {"HorizontalLine", "\342\224\200"},
+    {"ETH", "\303\220"},
+    {"ssmile", "\342\214\243"},
+    {"ngt", "\342\211\257"},
+    {"Element", "\342\210\210"},
+    {"Yopf", "\360\235\225\220"},
+    {"mlcp", "\342\253\233"},
+    {"vsupnE", "\342\253\214\357\270\200"},
+    {"ntrianglerighteq", "\342\213\255"},
+    {"Hat", "^"},
+    {"ddagger", "\342\200\241"},
+    {"leftthreetimes", "\342\213\213"},
+    {"nge", "\342\211\261"},
+    {"nsupseteq", "\342\212\211"},
+    {"therefore", "\342\210\264"},
+    {"shy", "\302\255"},
+    {"AMP", "&"},
+    {"compfn", "\342\210\230"},
+    {"origof", "\342\212\266"},
+    {"thksim", "\342\210\274"},
+    {"ohm", "\316\251"},
+    {"sqcup", "\342\212\224"},
+    {"marker", "\342\226\256"},
+    {"ufisht", "\342\245\276"},
+    {"Dot", "\302\250"},
+    {"LessGreater", "\342\211\266"},
+    {"dash", "\342\200\220"},
+    {"siml", "\342\252\235"},
+    {"Product", "\342\210\217"},
+    {"xhArr", "\342\237\272"},
+    {"mscr", "\360\235\223\202"},
+    {"Iopf", "\360\235\225\200"},
+    {"scnE", "\342\252\266"},
+    {"mp", "\342\210\223"},
+    {"YUcy", "\320\256"},
+    {"mu", "\316\274"},
+    {"NotSucceedsSlantEqual", "\342\213\241"},
+    {"submult", "\342\253\201"},
+    {"xuplus", "\342\250\204"},
+    {"succnapprox", "\342\252\272"},
+    {"leftarrowtail", "\342\206\242"},
+    {"lbbrk", "\342\235\262"},
+    {"bigcup", "\342\213\203"},
+    {"sigmav", "\317\202"},
+    {"ngE", "\342\211\247\314\270"},
+    {"Emacr", "\304\222"},
+    {"NotSuperset", "\342\212\203\342\203\222"},
+    {"capcup", "\342\251\207"},
+    {"shortparallel", "\342\210\245"},
+    {"nvgt", ">\342\203\222"},
+    {"tcy", "\321\202"},
+    {"sqcap", "\342\212\223"},
+    {"yuml", "\303\277"},
+    {"Acy", "\320\220"},
+    {"eqsim", "\342\211\202"},
+    {"ForAll", "\342\210\200"},
+    {"incare", "\342\204\205"},
+    {"iacute", "\303\255"},
+    {"lap", "\342\252\205"},
+    {"nvap", "\342\211\215\342\203\222"},
+    {"DoubleContourIntegral", "\342\210\257"},
+    {"ltcc", "\342\252\246"},
+    {"larrfs", "\342\244\235"},
+    {"prop", "\342\210\235"},
+    {"uparrow", "\342\206\221"},
+    {"SmallCircle", "\342\210\230"},
+    {"LessSlantEqual", "\342\251\275"},
+    {"Ecaron", "\304\232"},
+    {"dagger", "\342\200\240"},
+    {"duarr", "\342\207\265"},
+    {"nbump", "\342\211\216\314\270"},
+    {"angmsdah", "\342\246\257"},
+    {"lsimg", "\342\252\217"},
+    {"angmsdad", "\342\246\253"},
+    {"angmsdac", "\342\246\252"},
+    {"angmsdab", "\342\246\251"},
+    {"angmsdaa", "\342\246\250"},
+    {"Ifr", "\342\204\221"},
+    {"CirclePlus", "\342\212\225"},
+    {"rightleftarrows", "\342\207\204"},
+    {"ShortUpArrow", "\342\206\221"},
+    {"sigmaf", "\317\202"},
+    {"Aopf", "\360\235\224\270"},
+    {"prod", "\342\210\217"},
+    {"YIcy", "\320\207"},
+    {"Cedilla", "\302\270"},
+    {"nrtrie", "\342\213\255"},
+    {"qscr", "\360\235\223\206"},
+    {"ncedil", "\305\206"},
+    {"slarr", "\342\206\220"},
+    {"ast", "*"},
+    {"lsaquo", "\342\200\271"},
+    {"Zfr", "\342\204\250"},
+    {"gopf", "\360\235\225\230"},
+    {"RightTeeArrow", "\342\206\246"},
+    {"sqsubseteq", "\342\212\221"},
+    {"bot", "\342\212\245"},
+    {"not", "\302\254"},
+    {"boxvH", "\342\225\252"},
+    {"caret", "\342\201\201"},
+    {"ugrave", "\303\271"},
+    {"boxHu", "\342\225\247"},
+    {"LeftTee", "\342\212\243"},
+    {"PrecedesSlantEqual", "\342\211\274"},
+    {"boxvR", "\342\225\236"},
+    {"plusacir", "\342\250\243"},
+    {"boxdr", "\342\224\214"},
+    {"PartialD", "\342\210\202"},
+    {"succeq", "\342\252\260"},
+    {"nGt", "\342\211\253\342\203\222"},
+    {"downdownarrows", "\342\207\212"},
+    {"Lcedil", "\304\273"},
+    {"lBarr", "\342\244\216"},
+    {"gesdot", "\342\252\200"},
+    {"Vdashl", "\342\253\246"},
+    {"cularr", "\342\206\266"},
+    {"Oopf", "\360\235\225\206"},
+    {"nwArr", "\342\207\226"},
+    {"vcy", "\320\262"},
+    {"Jfr", "\360\235\224\215"},
+    {"Tscr", "\360\235\222\257"},
+    {"efDot", "\342\211\222"},
+    {"gE", "\342\211\247"},
+    {"boxdl", "\342\224\220"},
+    {"Gamma", "\316\223"},
+    {"backcong", "\342\211\214"},
+    {"boxvl", "\342\224\244"},
+    {"lmoustache", "\342\216\260"},
+    {"rbarr", "\342\244\215"},
+    {"angrt", "\342\210\237"},
+    {"filig", "\357\254\201"},
+    {"orderof", "\342\204\264"},
+    {"nspar", "\342\210\246"},
+    {"nlarr", "\342\206\232"},
+    {"ngtr", "\342\211\257"},
+    {"gcy", "\320\263"},
+    {"Cfr", "\342\204\255"},
+    {"NotEqual", "\342\211\240"},
+    {"UpTeeArrow", "\342\206\245"},
+    {"Mopf", "\360\235\225\204"},
+    {"boxHU", "\342\225\251"},
+    {"bprime", "\342\200\265"},
+    {"scnap", "\342\252\272"},
+    {"PrecedesEqual", "\342\252\257"},
+    {"napprox", "\342\211\211"},
+    {"boxdR", "\342\225\222"},
+    {"Beta", "\316\222"},
+    {"sub", "\342\212\202"},
+    {"beta", "\316\262"},
+    {"div", "\303\267"},
+    {"nwnear", "\342\244\247"},
+    {"topbot", "\342\214\266"},
+    {"DifferentialD", "\342\205\206"},
+    {"erarr", "\342\245\261"},
+    {"sqsupe", "\342\212\222"},
+    {"Darr", "\342\206\241"},
+    {"ccups", "\342\251\214"},
+    {"leftharpoonup", "\342\206\274"},
+    {"apid", "\342\211\213"},
+    {"xutri", "\342\226\263"},
+    {"jcirc", "\304\265"},
+    {"boxdL", "\342\225\225"},
+    {"mapstoleft", "\342\206\244"},
+    {"nedot", "\342\211\220\314\270"},
+    {"nrArr", "\342\207\217"},
+    {"sup", "\342\212\203"},
+    {"Idot", "\304\260"},
+    {"cupbrcap", "\342\251\210"},
+    {"tfr", "\360\235\224\261"},
+    {"supe", "\342\212\207"},
+    {"dcy", "\320\264"},
+    {"boxHD", "\342\225\246"},
+    {"imped", "\306\265"},
+    {"supedot", "\342\253\204"},
+    {"Supset", "\342\213\221"},
+    {"Or", "\342\251\224"},
+    {"xscr", "\360\235\223\215"},
+    {"simplus", "\342\250\244"},
+    {"ImaginaryI", "\342\205\210"},
+    {"sdotb", "\342\212\241"},
+    {"emsp14", "\342\200\205"},
+    {"xvee", "\342\213\201"},
+    {"doteqdot", "\342\211\221"},
+    {"emsp13", "\342\200\204"},
+    {"Barwed", "\342\214\206"},
+    {"LeftUpVector", "\342\206\277"},
+    {"Precedes", "\342\211\272"},
+    {"vartriangleleft", "\342\212\262"},
+    {"rightarrowtail", "\342\206\243"},
+    {"dlcrop", "\342\214\215"},
+    {"bullet", "\342\200\242"},
+    {"lacute", "\304\272"},
+    {"xcup", "\342\213\203"},
+    {"Ocy", "\320\236"},
+    {"csube", "\342\253\221"},
+    {"DoubleVerticalBar", "\342\210\245"},
+    {"zacute", "\305\272"},
+    {"shchcy", "\321\211"},
+    {"langd", "\342\246\221"},
+    {"laemptyv", "\342\246\264"},
+    {"rsh", "\342\206\261"},
+    {"SquareUnion", "\342\212\224"},
+    {"realine", "\342\204\233"},
+    {"lcedil", "\304\274"},
+    {"Ascr", "\360\235\222\234"},
+    {"Cap", "\342\213\222"},
+    {"larrtl", "\342\206\242"},
+    {"SquareIntersection", "\342\212\223"},
+    {"RightArrowBar", "\342\207\245"},
+    {"bnequiv", "\342\211\241\342\203\245"},
+    {"NegativeThickSpace", "\342\200\213"},
+    {"pm", "\302\261"},
+    {"squ", "\342\226\241"},
+    {"nvrtrie", "\342\212\265\342\203\222"},
+    {"Lang", "\342\237\252"},
+    {"boxhu", "\342\224\264"},
+    {"ZeroWidthSpace", "\342\200\213"},
+    {"mcomma", "\342\250\251"},
+    {"UpEquilibrium", "\342\245\256"},
+    {"odsold", "\342\246\274"},
+    {"Gcy", "\320\223"},
+    {"eogon", "\304\231"},
+    {"Xopf", "\360\235\225\217"},
+    {"sqsubset", "\342\212\217"},
+    {"harr", "\342\206\224"},
+    {"subsim", "\342\253\207"},
+    {"lsquo", "\342\200\230"},
+    {"RightArrowLeftArrow", "\342\207\204"},
+    {"int", "\342\210\253"},
+    {"gvertneqq", "\342\211\251\357\270\200"},
+    {"gl", "\342\211\267"},
+    {"Ofr", "\360\235\224\222"},
+    {"Lambda", "\316\233"},
+    {"upharpoonleft", "\342\206\277"},
+    {"Dfr", "\360\235\224\207"},
+    {"Congruent", "\342\211\241"},
+    {"reg", "\302\256"},
+    {"supne", "\342\212\213"},
+    {"Rarrtl", "\342\244\226"},
+    {"ge", "\342\211\245"},
+    {"part", "\342\210\202"},
+    {"gg", "\342\211\253"},
+    {"ang", "\342\210\240"},
+    {"popf", "\360\235\225\241"},
+    {"ShortLeftArrow", "\342\206\220"},
+    {"nsup", "\342\212\205"},
+    {"Escr", "\342\204\260"},
+    {"blk34", "\342\226\223"},
+    {"longleftarrow", "\342\237\265"},
+    {"NotLessTilde", "\342\211\264"},
+    {"supdot", "\342\252\276"},
+    {"upharpoonright", "\342\206\276"},
+    {"rHar", "\342\245\244"},
+    {"divideontimes", "\342\213\207"},
+    {"gtrapprox", "\342\252\206"},
+    {"rbrke", "\342\246\214"},
+    {"cupdot", "\342\212\215"},
+    {"esim", "\342\211\202"},
+    {"drbkarow", "\342\244\220"},
+    {"QUOT", "\""},
+    {"thinsp", "\342\200\211"},
+    {"ni", "\342\210\213"},
+    {"supseteq", "\342\212\207"},
+    {"cuwed", "\342\213\217"},
+    {"sqsupseteq", "\342\212\222"},
+    {"laquo", "\302\253"},
+    {"circlearrowright", "\342\206\273"},
+    {"DownArrowUpArrow", "\342\207\265"},
+    {"starf", "\342\230\205"},
+    {"suplarr", "\342\245\273"},
+    {"beth", "\342\204\266"},
+    {"swnwar", "\342\244\252"},
+    {"NotGreaterLess", "\342\211\271"},
+    {"bepsi", "\317\266"},
+    {"bNot", "\342\253\255"},
+    {"frac56", "\342\205\232"},
+    {"nshortparallel", "\342\210\246"},
+    {"bull", "\342\200\242"},
+    {"Proportional", "\342\210\235"},
+    {"Therefore", "\342\210\264"},
+    {"Aacute", "\303\201"},
+    {"Ntilde", "\303\221"},
+    {"LeftArrowRightArrow", "\342\207\206"},
+    {"gne", "\342\252\210"},
+    {"Sum", "\342\210\221"},
+    {"frac58", "\342\205\235"},
+    {"racute", "\305\225"},
+    {"blacktriangle", "\342\226\264"},
+    {"nleq", "\342\211\260"},
+    {"opar", "\342\246\267"},
+    {"suphsol", "\342\237\211"},
+    {"becaus", "\342\210\265"},
+    {"rharul", "\342\245\254"},
+    {"nles", "\342\251\275\314\270"},
+    {"LeftCeiling", "\342\214\210"},
+    {"iiiint", "\342\250\214"},
+    {"rarrpl", "\342\245\205"},
+    {"ldsh", "\342\206\262"},
+    {"succ", "\342\211\273"},
+    {"Uparrow", "\342\207\221"},
+    {"DiacriticalGrave", "`"},
+    {"NotLessLess", "\342\211\252\314\270"},
+    {"lat", "\342\252\253"},
+    {"lbrkslu", "\342\246\215"},
+    {"NotNestedLessLess", "\342\252\241\314\270"},
+    {"rdquor", "\342\200\235"},
+    {"wedgeq", "\342\211\231"},
+    {"Cayleys", "\342\204\255"},
+    {"solbar", "\342\214\277"},
+    {"TripleDot", "\342\203\233"},
+    {"cir", "\342\227\213"},
+    {"scpolint", "\342\250\223"},
+    {"oint", "\342\210\256"},
+    {"HumpEqual", "\342\211\217"},
+    {"nsubset", "\342\212\202\342\203\222"},
+    {"ucy", "\321\203"},
+    {"Ubreve", "\305\254"},
+    {"lcaron", "\304\276"},
+    {"RightArrow", "\342\206\222"},
+    {"rarrsim", "\342\245\264"},
+    {"SquareSuperset", "\342\212\220"},
+    {"curarr", "\342\206\267"},
+    {"simdot", "\342\251\252"},
+    {"fscr", "\360\235\222\273"},
+    {"rArr", "\342\207\222"},
+    {"Edot", "\304\226"},
+    {"and", "\342\210\247"},
+    {"searr", "\342\206\230"},
+    {"Ffr", "\360\235\224\211"},
+    {"odot", "\342\212\231"},
+    {"smid", "\342\210\243"},
+    {"ldca", "\342\244\266"},
+    {"latail", "\342\244\231"},
+    {"cwint", "\342\210\261"},
+    {"fflig", "\357\254\200"},
+    {"llcorner", "\342\214\236"},
+    {"djcy", "\321\222"},
+    {"kappa", "\316\272"},
+    {"raemptyv", "\342\246\263"},
+    {"Lscr", "\342\204\222"},
+    {"DiacriticalTilde", "\313\234"},
+    {"isinE", "\342\213\271"},
+    {"rarrlp", "\342\206\254"},
+    {"rtriltri", "\342\247\216"},
+    {"period", "."},
+    {"ratail", "\342\244\232"},
+    {"dashv", "\342\212\243"},
+    {"CounterClockwiseContourIntegral", "\342\210\263"},
+    {"lE", "\342\211\246"},
+    {"searhk", "\342\244\245"},
+    {"RBarr", "\342\244\220"},
+    {"plusdo", "\342\210\224"},
+    {"sup1", "\302\271"},
+    {"ReverseEquilibrium", "\342\207\213"},
+    {"boxplus", "\342\212\236"},
+    {"sce", "\342\252\260"},
+    {"vee", "\342\210\250"},
+    {"rAarr", "\342\207\233"},
+    {"trade", "\342\204\242"},
+    {"triangle", "\342\226\265"},
+    {"mumap", "\342\212\270"},
+    {"xdtri", "\342\226\275"},
+    {"ii", "\342\205\210"},
+    {"abreve", "\304\203"},
+    {"boxvh", "\342\224\274"},
+    {"Sfr", "\360\235\224\226"},
+    {"NotSquareSubset", "\342\212\217\314\270"},
+    {"CHcy", "\320\247"},
+    {"gap", "\342\252\206"},
+    {"otilde", "\303\265"},
+    {"NotDoubleVerticalBar", "\342\210\246"},
+    {"mcy", "\320\274"},
+    {"DownArrowBar", "\342\244\223"},
+    {"njcy", "\321\232"},
+    {"glj", "\342\252\244"},
+    {"plusdu", "\342\250\245"},
+    {"eqcolon", "\342\211\225"},
+    {"iprod", "\342\250\274"},
+    {"smt", "\342\252\252"},
+    {"gla", "\342\252\245"},
+    {"lmoust", "\342\216\260"},
+    {"elinters", "\342\217\247"},
+    {"longrightarrow", "\342\237\266"},
+    {"boxvr", "\342\224\234"},
+    {"orslope", "\342\251\227"},
+    {"Popf", "\342\204\231"},
+    {"cemptyv", "\342\246\262"},
+    {"gfr", "\360\235\224\244"},
+    {"longmapsto", "\342\237\274"},
+    {"loarr", "\342\207\275"},
+    {"OElig", "\305\222"},
+    {"ltrPar", "\342\246\226"},
+    {"boxvL", "\342\225\241"},
+    {"Oacute", "\303\223"},
+    {"simg", "\342\252\236"},
+    {"olcross", "\342\246\273"},
+    {"Lt", "\342\211\252"},
+    {"rcedil", "\305\227"},
+    {"euml", "\303\253"},
+    {"rbrack", "]"},
+    {"gnapprox", "\342\252\212"},
+    {"boxul", "\342\224\230"},
+    {"realpart", "\342\204\234"},
+    {"circledR", "\302\256"},
+    {"circledS", "\342\223\210"},
+    {"approxeq", "\342\211\212"},
+    {"varepsilon", "\317\265"},
+    {"ropar", "\342\246\206"},
+    {"luruhar", "\342\245\246"},
+    {"caron", "\313\207"},
+    {"Acirc", "\303\202"},
+    {"nopf", "\360\235\225\237"},
+    {"Superset", "\342\212\203"},
+    {"Implies", "\342\207\222"},
+    {"NotSubsetEqual", "\342\212\210"},
+    {"eta", "\316\267"},
+    {"sect", "\302\247"},
+    {"xharr", "\342\237\267"},
+    {"RightUpVector", "\342\206\276"},
+    {"Ugrave", "\303\231"},
+    {"sime", "\342\211\203"},
+    {"NotTilde", "\342\211\201"},
+    {"eth", "\303\260"},
+    {"Re", "\342\204\234"},
+    {"plankv", "\342\204\217"},
+    {"umacr", "\305\253"},
+    {"DJcy", "\320\202"},
+    {"Sc", "\342\252\274"},
+    {"udblac", "\305\261"},
+    {"ijlig", "\304\263"},
+    {"natural", "\342\231\256"},
+    {"szlig", "\303\237"},
+    {"Kfr", "\360\235\224\216"},
+    {"centerdot", "\302\267"},
+    {"egsdot", "\342\252\230"},
+    {"TScy", "\320\246"},
+    {"topfork", "\342\253\232"},
+    {"edot", "\304\227"},
+    {"times", "\303\227"},
+    {"xrArr", "\342\237\271"},
+    {"Tcaron", "\305\244"},
+    {"auml", "\303\244"},
+    {"les", "\342\251\275"},
+    {"boxuL", "\342\225\233"},
+    {"uuml", "\303\274"},
+    {"UpDownArrow", "\342\206\225"},
+    {"nu", "\316\275"},
+    {"xcap", "\342\213\202"},
+    {"andd", "\342\251\234"},
+    {"iexcl", "\302\241"},
+    {"excl", "!"},
+    {"Gdot", "\304\240"},
+    {"llarr", "\342\207\207"},
+    {"lHar", "\342\245\242"},
+    {"cularrp", "\342\244\275"},
+    {"npre", "\342\252\257\314\270"},
+    {"exist", "\342\210\203"},
+    {"oscr", "\342\204\264"},
+    {"barvee", "\342\212\275"},
+    {"Rang", "\342\237\253"},
+    {"ldquo", "\342\200\234"},
+    {"DownRightVectorBar", "\342\245\227"},
+    {"scaron", "\305\241"},
+    {"DownLeftVector", "\342\206\275"},
+    {"uharl", "\342\206\277"},
+    {"nisd", "\342\213\272"},
+    {"OverBrace", "\342\217\236"},
+    {"frac35", "\342\205\227"},
+    {"kcy", "\320\272"},
+    {"Vscr", "\360\235\222\261"},
+    {"check", "\342\234\223"},
+    {"bsolb", "\342\247\205"},
+    {"hookrightarrow", "\342\206\252"},
+    {"equiv", "\342\211\241"},
+    {"leftrightharpoons", "\342\207\213"},
+    {"gacute", "\307\265"},
+    {"jfr", "\360\235\224\247"},
+    {"Vfr", "\360\235\224\231"},
+    {"Epsilon", "\316\225"},
+    {"conint", "\342\210\256"},
+    {"between", "\342\211\254"},
+    {"cfr", "\360\235\224\240"},
+    {"rightthreetimes", "\342\213\214"},
+    {"bump", "\342\211\216"},
+    {"cuepr", "\342\213\236"},
+    {"phiv", "\317\225"},
+    {"cupcap", "\342\251\206"},
+    {"mdash", "\342\200\224"},
+    {"Assign", "\342\211\224"},
+    {"LessEqualGreater", "\342\213\232"},
+    {"suphsub", "\342\253\227"},
+    {"LessTilde", "\342\211\262"},
+    {"rbbrk", "\342\235\263"},
+    {"vartriangleright", "\342\212\263"},
+    {"Upsi", "\317\222"},
+    {"nsqsube", "\342\213\242"},
+    {"Ubrcy", "\320\216"},
+    {"Laplacetrf", "\342\204\222"},
+    {"smallsetminus", "\342\210\226"},
+    {"YAcy", "\320\257"},
+    {"congdot", "\342\251\255"},
+    {"ograve", "\303\262"},
+    {"telrec", "\342\214\225"},
+    {"Gcedil", "\304\242"},
+    {"drcrop", "\342\214\214"},
+    {"lsime", "\342\252\215"},
+    {"Rsh", "\342\206\261"},
+    {"NotSquareSupersetEqual", "\342\213\243"},
+    {"clubs", "\342\231\243"},
+    {"propto", "\342\210\235"},
+    {"backsimeq", "\342\213\215"},
+    {"lrhar", "\342\207\213"},
+    {"radic", "\342\210\232"},
+    {"prsim", "\342\211\276"},
+    {"gesdotol", "\342\252\204"},
+    {"barwedge", "\342\214\205"},
+    {"alpha", "\316\261"},
+    {"rbrace", "}"},
+    {"nleftarrow", "\342\206\232"},
+    {"Uscr", "\360\235\222\260"},
+    {"supsim", "\342\253\210"},
+    {"angrtvb", "\342\212\276"},
+    {"Oscr", "\360\235\222\252"},
+    {"lthree", "\342\213\213"},
+    {"order", "\342\204\264"},
+    {"ecir", "\342\211\226"},
+    {"EqualTilde", "\342\211\202"},
+    {"rpargt", "\342\246\224"},
+    {"gel", "\342\213\233"},
+    {"duhar", "\342\245\257"},
+    {"hamilt", "\342\204\213"},
+    {"roplus", "\342\250\256"},
+    {"xnis", "\342\213\273"},
+    {"RightVector", "\342\207\200"},
+    {"DownRightVector", "\342\207\201"},
+    {"ecolon", "\342\211\225"},
+    {"fopf", "\360\235\225\227"},
+    {"UpArrow", "\342\206\221"},
+    {"SquareSubsetEqual", "\342\212\221"},
+    {"hkswarow", "\342\244\246"},
+    {"nRightarrow", "\342\207\217"},
+    {"vdash", "\342\212\242"},
+    {"lrarr", "\342\207\206"},
+    {"langle", "\342\237\250"},
+    {"dblac", "\313\235"},
+    {"el", "\342\252\231"},
+    {"nvle", "\342\211\244\342\203\222"},
+    {"aleph", "\342\204\265"},
+    {"bsolhsub", "\342\237\210"},
+    {"blacktriangledown", "\342\226\276"},
+    {"profsurf", "\342\214\223"},
+    {"easter", "\342\251\256"},
+    {"fjlig", "fj"},
+    {"Ccaron", "\304\214"},
+    {"supdsub", "\342\253\230"},
+    {"eqcirc", "\342\211\226"},
+    {"LeftArrowBar", "\342\207\244"},
+    {"twoheadleftarrow", "\342\206\236"},
+    {"eg", "\342\252\232"},
+    {"Gammad", "\317\234"},
+    {"Tstrok", "\305\246"},
+    {"yicy", "\321\227"},
+    {"notni", "\342\210\214"},
+    {"qint", "\342\250\214"},
+    {"hopf", "\360\235\225\231"},
+    {"star", "\342\230\206"},
+    {"phmmat", "\342\204\263"},
+    {"subplus", "\342\252\277"},
+    {"Dcy", "\320\224"},
+    {"frasl", "\342\201\204"},
+    {"bigoplus", "\342\250\201"},
+    {"Verbar", "\342\200\226"},
+    {"bigvee", "\342\213\201"},
+    {"trie", "\342\211\234"},
+    {"GJcy", "\320\203"},
+    {"lbarr", "\342\244\214"},
+    {"zhcy", "\320\266"},
+    {"Hcirc", "\304\244"},
+    {"simlE", "\342\252\237"},
+    {"NonBreakingSpace", "\302\240"},
+    {"coloneq", "\342\211\224"},
+    {"ecirc", "\303\252"},
+    {"And", "\342\251\223"},
+    {"ensp", "\342\200\202"},
+    {"nsucc", "\342\212\201"},
+    {"colone", "\342\211\224"},
+    {"NoBreak", "\342\201\240"},
+    {"profline", "\342\214\222"},
+    {"softcy", "\321\214"},
+    {"larrb", "\342\207\244"},
+    {"intprod", "\342\250\274"},
+    {"rarrfs", "\342\244\236"},
+    {"dharr", "\342\207\202"},
+    {"KHcy", "\320\245"},
+    {"vzigzag", "\342\246\232"},
+    {"LeftUpDownVector", "\342\245\221"},
+    {"dharl", "\342\207\203"},
+    {"sqsup", "\342\212\220"},
+    {"NotGreaterTilde", "\342\211\265"},
+    {"rmoustache", "\342\216\261"},
+    {"Ropf", "\342\204\235"},
+    {"LeftVector", "\342\206\274"},
+    {"ccaron", "\304\215"},
+    {"RightTriangle", "\342\212\263"},
+    {"nsc", "\342\212\201"},
+    {"NotLessGreater", "\342\211\270"},
+    {"UnionPlus", "\342\212\216"},
+    {"Tcy", "\320\242"},
+    {"prE", "\342\252\263"},
+    {"Dcaron", "\304\216"},
+    {"hksearow", "\342\244\245"},
+    {"preccurlyeq", "\342\211\274"},
+    {"ntgl", "\342\211\271"},
+    {"bcy", "\320\261"},
+    {"oS", "\342\223\210"},
+    {"nsim", "\342\211\201"},
+    {"yacute", "\303\275"},
+    {"lbrksld", "\342\246\217"},
+    {"piv", "\317\226"},
+    {"veeeq", "\342\211\232"},
+    {"Poincareplane", "\342\204\214"},
+    {"sext", "\342\234\266"},
+    {"rppolint", "\342\250\222"},
+    {"Pfr", "\360\235\224\223"},
+    {"Bopf", "\360\235\224\271"},
+    {"lArr", "\342\207\220"},
+    {"orarr", "\342\206\273"},
+    {"ltimes", "\342\213\211"},
+    {"hybull", "\342\201\203"},
+    {"notinE", "\342\213\271\314\270"},
+    {"nshortmid", "\342\210\244"},
+    {"leqq", "\342\211\246"},
+    {"GreaterSlantEqual", "\342\251\276"},
+    {"blk12", "\342\226\222"},
+    {"complement", "\342\210\201"},
+    {"Int", "\342\210\254"},
+    {"simne", "\342\211\206"},
+    {"otimes", "\342\212\227"},
+    {"uuarr", "\342\207\210"},
+    {"gtreqless", "\342\213\233"},
+    {"gtdot", "\342\213\227"},
+    {"smtes", "\342\252\254\357\270\200"},
+    {"intercal", "\342\212\272"},
+    {"ogt", "\342\247\201"},
+    {"tshcy", "\321\233"},
+    {"nwarrow", "\342\206\226"},
+    {"Succeeds", "\342\211\273"},
+    {"Sacute", "\305\232"},
+    {"xmap", "\342\237\274"},
+    {"oslash", "\303\270"},
+    {"block", "\342\226\210"},
+    {"zigrarr", "\342\207\235"},
+    {"ominus", "\342\212\226"},
+    {"ncap", "\342\251\203"},
+    {"Hopf", "\342\204\215"},
+    {"dlcorn", "\342\214\236"},
+    {"Vee", "\342\213\201"},
+    {"Vbar", "\342\253\253"},
+    {"nsupset", "\342\212\203\342\203\222"},
+    {"NotLeftTriangleEqual", "\342\213\254"},
+    {"Yacute", "\303\235"},
+    {"infintie", "\342\247\235"},
+    {"notindot", "\342\213\265\314\270"},
+    {"Uacute", "\303\232"},
+    {"eopf", "\360\235\225\226"},
+    {"apos", "'"},
+    {"CloseCurlyQuote", "\342\200\231"},
+    {"Auml", "\303\204"},
+    {"rect", "\342\226\255"},
+    {"scirc", "\305\235"},
+    {"swarhk", "\342\244\246"},
+    {"ap", "\342\211\210"},
+    {"nsime", "\342\211\204"},
+    {"bbrktbrk", "\342\216\266"},
+    {"eqvparsl", "\342\247\245"},
+    {"kjcy", "\321\234"},
+    {"upsilon", "\317\205"},
+    {"xodot", "\342\250\200"},
+    {"Afr", "\360\235\224\204"},
+    {"rhov", "\317\261"},
+    {"acy", "\320\260"},
+    {"af", "\342\201\241"},
+    {"Jukcy", "\320\204"},
+    {"nearhk", "\342\244\244"},
+    {"precnapprox", "\342\252\271"},
+    {"boxminus", "\342\212\237"},
+    {"ac", "\342\210\276"},
+    {"lparlt", "\342\246\223"},
+    {"Iacute", "\303\215"},
+    {"Integral", "\342\210\253"},
+    {"precneqq", "\342\252\265"},
+    {"Jopf", "\360\235\225\201"},
+    {"RightAngleBracket", "\342\237\251"},
+    {"Gfr", "\360\235\224\212"},
+    {"ovbar", "\342\214\275"},
+    {"rangd", "\342\246\222"},
+    {"dotplus", "\342\210\224"},
+    {"range", "\342\246\245"},
+    {"hfr", "\360\235\224\245"},
+    {"dotsquare", "\342\212\241"},
+    {"Nscr", "\360\235\222\251"},
+    {"Exists", "\342\210\203"},
+    {"bkarow", "\342\244\215"},
+    {"iuml", "\303\257"},
+    {"angzarr", "\342\215\274"},
+    {"lt", "<"},
+    {"acd", "\342\210\277"},
+    {"sc", "\342\211\273"},
+    {"supset", "\342\212\203"},
+    {"npreceq", "\342\252\257\314\270"},
+    {"Itilde", "\304\250"},
+    {"bernou", "\342\204\254"},
+    {"pertenk", "\342\200\261"},
+    {"Psi", "\316\250"},
+    {"Ouml", "\303\226"},
+    {"FilledSmallSquare", "\342\227\274"},
+    {"bigodot", "\342\250\200"},
+    {"ntriangleleft", "\342\213\252"},
+    {"tritime", "\342\250\273"},
+    {"NestedLessLess", "\342\211\252"},
+    {"uacute", "\303\272"},
+    {"Eta", "\316\227"},
+    {"Yscr", "\360\235\222\264"},
+    {"COPY", "\302\251"},
+    {"Hstrok", "\304\246"},
+    {"in", "\342\210\210"},
+    {"bbrk", "\342\216\265"},
+    {"DZcy", "\320\217"},
+    {"dcaron", "\304\217"},
+    {"notniva", "\342\210\214"},
+    {"Tfr", "\360\235\224\227"},
+    {"omid", "\342\246\266"},
+    {"Efr", "\360\235\224\210"},
+    {"lnsim", "\342\213\246"},
+    {"or", "\342\210\250"},
+    {"Nopf", "\342\204\225"},
+    {"rceil", "\342\214\211"},
+    {"ic", "\342\201\243"},
+    {"comp", "\342\210\201"},
+    {"ascr", "\360\235\222\266"},
+    {"ncongdot", "\342\251\255\314\270"},
+    {"Ncy", "\320\235"},
+    {"rsqb", "]"},
+    {"eDot", "\342\211\221"},
+    {"breve", "\313\230"},
+    {"ShortRightArrow", "\342\206\222"},
+    {"ratio", "\342\210\266"},
+    {"Odblac", "\305\220"},
+    {"LeftFloor", "\342\214\212"},
+    {"LeftRightVector", "\342\245\216"},
+    {"gscr", "\342\204\212"},
+    {"lsh", "\342\206\260"},
+    {"disin", "\342\213\262"},
+    {"cap", "\342\210\251"},
+    {"bsemi", "\342\201\217"},
+    {"Subset", "\342\213\220"},
+    {"frac34", "\302\276"},
+    {"rsquo", "\342\200\231"},
+    {"numero", "\342\204\226"},
+    {"Lstrok", "\305\201"},
+    {"glE", "\342\252\222"},
+    {"Ucirc", "\303\233"},
+    {"lambda", "\316\273"},
+    {"thickapprox", "\342\211\210"},
+    {"Leftarrow", "\342\207\220"},
+    {"Longrightarrow", "\342\237\271"},
+    {"nVdash", "\342\212\256"},
+    {"boxuR", "\342\225\230"},
+    {"subrarr", "\342\245\271"},
+    {"harrw", "\342\206\255"},
+    {"vDash", "\342\212\250"},
+    {"eDDot", "\342\251\267"},
+    {"notnivc", "\342\213\275"},
+    {"nhArr", "\342\207\216"},
+    {"nsupe", "\342\212\211"},
+    {"Scirc", "\305\234"},
+    {"cup", "\342\210\252"},
+    {"LeftDownVector", "\342\207\203"},
+    {"vArr", "\342\207\225"},
+    {"sqcups", "\342\212\224\357\270\200"},
+    {"capand", "\342\251\204"},
+    {"UpTee", "\342\212\245"},
+    {"boxVL", "\342\225\243"},
+    {"spades", "\342\231\240"},
+    {"bumpE", "\342\252\256"},
+    {"bigcirc", "\342\227\257"},
+    {"lfisht", "\342\245\274"},
+    {"DiacriticalAcute", "\302\264"},
+    {"natur", "\342\231\256"},
+    {"olt", "\342\247\200"},
+    {"gesdoto", "\342\252\202"},
+    {"sfr", "\360\235\224\260"},
+    {"Upsilon", "\316\245"},
+    {"mstpos", "\342\210\276"},
+    {"nap", "\342\211\211"},
+    {"ifr", "\360\235\224\246"},
+    {"Eacute", "\303\211"},
+    {"boxVh", "\342\225\253"},
+    {"fllig", "\357\254\202"},
+    {"Lmidot", "\304\277"},
+    {"squf", "\342\226\252"},
+    {"boxUr", "\342\225\231"},
+    {"psi", "\317\210"},
+    {"smashp", "\342\250\263"},
+    {"angsph", "\342\210\242"},
+    {"gtcc", "\342\252\247"},
+    {"ReverseUpEquilibrium", "\342\245\257"},
+    {"ncong", "\342\211\207"},
+    {"uhblk", "\342\226\200"},
+    {"rarrtl", "\342\206\243"},
+    {"llhard", "\342\245\253"},
+    {"Diamond", "\342\213\204"},
+    {"odash", "\342\212\235"},
+    {"angst", "\303\205"},
+    {"RightCeiling", "\342\214\211"},
+    {"boxVr", "\342\225\237"},
+    {"ThinSpace", "\342\200\211"},
+    {"naturals", "\342\204\225"},
+    {"Ccirc", "\304\210"},
+    {"leftarrow", "\342\206\220"},
+    {"InvisibleComma", "\342\201\243"},
+    {"zwj", "\342\200\215"},
+    {"npr", "\342\212\200"},
+    {"nprcue", "\342\213\240"},
+    {"sdote", "\342\251\246"},
+    {"wcirc", "\305\265"},
+    {"looparrowright", "\342\206\254"},
+    {"Phi", "\316\246"},
+    {"blk14", "\342\226\221"},
+    {"nrightarrow", "\342\206\233"},
+    {"expectation", "\342\204\260"},
+    {"subsetneq", "\342\212\212"},
+    {"lozenge", "\342\227\212"},
+    {"bigsqcup", "\342\250\206"},
+    {"yscr", "\360\235\223\216"},
+    {"DScy", "\320\205"},
+    {"frac78", "\342\205\236"},
+    {"strns", "\302\257"},
+    {"nleftrightarrow", "\342\206\256"},
+    {"NotLess", "\342\211\256"},
+    {"acE", "\342\210\276\314\263"},
+    {"LT", "<"},
+    {"oopf", "\360\235\225\240"},
+    {"Gopf", "\360\235\224\276"},
+    {"Copf", "\342\204\202"},
+    {"bottom", "\342\212\245"},
+    {"xcirc", "\342\227\257"},
+    {"Bcy", "\320\221"},
+    {"Tcedil", "\305\242"},
+    {"odiv", "\342\250\270"},
+    {"RoundImplies", "\342\245\260"},
+    {"nvlt", "<\342\203\222"},
+    {"bumpe", "\342\211\217"},
+    {"equivDD", "\342\251\270"},
+    {"nis", "\342\213\274"},
+    {"utri", "\342\226\265"},
+    {"Dstrok", "\304\220"},
+    {"NotRightTriangle", "\342\213\253"},
+    {"lceil", "\342\214\210"},
+    {"blacklozenge", "\342\247\253"},
+    {"RightVectorBar", "\342\245\223"},
+    {"Barv", "\342\253\247"},
+    {"nrarr", "\342\206\233"},
+    {"demptyv", "\342\246\261"},
+    {"nsccue", "\342\213\241"},
+    {"emacr", "\304\223"},
+    {"DoubleLongRightArrow", "\342\237\271"},
+    {"Bernoullis", "\342\204\254"},
+    {"cuesc", "\342\213\237"},
+    {"NotGreaterFullEqual", "\342\211\247\314\270"},
+    {"niv", "\342\210\213"},
+    {"DotDot", "\342\203\234"},
+    {"NegativeMediumSpace", "\342\200\213"},
+    {"mDDot", "\342\210\272"},
+    {"uml", "\302\250"},
+    {"cupcup", "\342\251\212"},
+    {"rightharpoonup", "\342\207\200"},
+    {"hoarr", "\342\207\277"},
+    {"Ll", "\342\213\230"},
+    {"sdot", "\342\213\205"},
+    {"dot", "\313\231"},
+    {"amp", "&"},
+    {"Intersection", "\342\213\202"},
+    {"RightDoubleBracket", "\342\237\247"},
+    {"triminus", "\342\250\272"},
+    {"oacute", "\303\263"},
+    {"urcorn", "\342\214\235"},
+    {"Zacute", "\305\271"},
+    {"swArr", "\342\207\231"},
+    {"leqslant", "\342\251\275"},
+    {"chcy", "\321\207"},
+    {"Fopf", "\360\235\224\275"},
+    {"succcurlyeq", "\342\211\275"},
+    {"mnplus", "\342\210\223"},
+    {"Gscr", "\360\235\222\242"},
+    {"gt", ">"},
+    {"ycirc", "\305\267"},
+    {"harrcir", "\342\245\210"},
+    {"ThickSpace", "\342\201\237\342\200\212"},
+    {"itilde", "\304\251"},
+    {"smte", "\342\252\254"},
+    {"lowast", "\342\210\227"},
+    {"Scedil", "\305\236"},
+    {"lltri", "\342\227\272"},
+    {"uharr", "\342\206\276"},
+    {"lgE", "\342\252\221"},
+    {"intlarhk", "\342\250\227"},
+    {"gcirc", "\304\235"},
+    {"nwarr", "\342\206\226"},
+    {"verbar", "|"},
+    {"RightTriangleEqual", "\342\212\265"},
+    {"xi", "\316\276"},
+    {"vopf", "\360\235\225\247"},
+    {"coprod", "\342\210\220"},
+    {"wr", "\342\211\200"},
+    {"bscr", "\360\235\222\267"},
+    {"NotCongruent", "\342\211\242"},
+    {"yacy", "\321\217"},
+    {"subset", "\342\212\202"},
+    {"spar", "\342\210\245"},
+    {"nvDash", "\342\212\255"},
+    {"cudarrl", "\342\244\270"},
+    {"bsim", "\342\210\275"},
+    {"cdot", "\304\213"},
+    {"circ", "\313\206"},
+    {"nges", "\342\251\276\314\270"},
+    {"SucceedsSlantEqual", "\342\211\275"},
+    {"Lcaron", "\304\275"},
+    {"ccaps", "\342\251\215"},
+    {"Iota", "\316\231"},
+    {"nmid", "\342\210\244"},
+    {"supE", "\342\253\206"},
+    {"copy", "\302\251"},
+    {"lhblk", "\342\226\204"},
+    {"swarrow", "\342\206\231"},
+    {"oline", "\342\200\276"},
+    {"ubrcy", "\321\236"},
+    {"LeftTriangleEqual", "\342\212\264"},
+    {"Egrave", "\303\210"},
+    {"prcue", "\342\211\274"},
+    {"wedbar", "\342\251\237"},
+    {"triplus", "\342\250\271"},
+    {"micro", "\302\265"},
+    {"Bscr", "\342\204\254"},
+    {"gsiml", "\342\252\220"},
+    {"Rrightarrow", "\342\207\233"},
+    {"sccue", "\342\211\275"},
+    {"sstarf", "\342\213\206"},
+    {"khcy", "\321\205"},
+    {"nprec", "\342\212\200"},
+    {"par", "\342\210\245"},
+    {"circeq", "\342\211\227"},
+    {"roarr", "\342\207\276"},
+    {"dzcy", "\321\237"},
+    {"gtrarr", "\342\245\270"},
+    {"rfr", "\360\235\224\257"},
+    {"Cconint", "\342\210\260"},
+    {"uplus", "\342\212\216"},
+    {"Iogon", "\304\256"},
+    {"gimel", "\342\204\267"},
+    {"ufr", "\360\235\224\262"},
+    {"andv", "\342\251\232"},
+    {"Kscr", "\360\235\222\246"},
+    {"napE", "\342\251\260\314\270"},
+    {"backepsilon", "\317\266"},
+    {"NotHumpDownHump", "\342\211\216\314\270"},
+    {"kfr", "\360\235\224\250"},
+    {"DoubleUpDownArrow", "\342\207\225"},
+    {"gnE", "\342\211\251"},
+    {"cirE", "\342\247\203"},
+    {"asympeq", "\342\211\215"},
+    {"nltri", "\342\213\252"},
+    {"escr", "\342\204\257"},
+    {"rotimes", "\342\250\265"},
+    {"iukcy", "\321\226"},
+    {"minus", "\342\210\222"},
+    {"lrhard", "\342\245\255"},
+    {"middot", "\302\267"},
+    {"prnE", "\342\252\265"},
+    {"planckh", "\342\204\216"},
+    {"loz", "\342\227\212"},
+    {"LeftArrow", "\342\206\220"},
+    {"subE", "\342\253\205"},
+    {"gamma", "\316\263"},
+    {"fcy", "\321\204"},
+    {"hcirc", "\304\245"},
+    {"thicksim", "\342\210\274"},
+    {"srarr", "\342\206\222"},
+    {"varsupsetneqq", "\342\253\214\357\270\200"},
+    {"diamondsuit", "\342\231\246"},
+    {"leg", "\342\213\232"},
+    {"curvearrowleft", "\342\206\266"},
+    {"frac25", "\342\205\226"},
+    {"lang", "\342\237\250"},
+    {"numsp", "\342\200\207"},
+    {"lbrke", "\342\246\213"},
+    {"scedil", "\305\237"},
+    {"nexists", "\342\210\204"},
+    {"DDotrahd", "\342\244\221"},
+    {"Hacek", "\313\207"},
+    {"minusb", "\342\212\237"},
+    {"dwangle", "\342\246\246"},
+    {"ange", "\342\246\244"},
+    {"rarrap", "\342\245\265"},
+    {"smeparsl", "\342\247\244"},
+    {"simrarr", "\342\245\262"},
+    {"geqq", "\342\211\247"},
+    {"SHCHcy", "\320\251"},
+    {"osol", "\342\212\230"},
+    {"Downarrow", "\342\207\223"},
+    {"alefsym", "\342\204\265"},
+    {"Vdash", "\342\212\251"},
+    {"Utilde", "\305\250"},
+    {"cacute", "\304\207"},
+    {"varpropto", "\342\210\235"},
+    {"drcorn", "\342\214\237"},
+    {"prnsim", "\342\213\250"},
+    {"semi", ";"},
+    {"copysr", "\342\204\227"},
+    {"scap", "\342\252\270"},
+    {"boxUR", "\342\225\232"},
+    {"nparallel", "\342\210\246"},
+    {"Mcy", "\320\234"},
+    {"Tab", "\011"},
+    {"prurel", "\342\212\260"},
+    {"jukcy", "\321\224"},
+    {"prnap", "\342\252\271"},
+    {"vltri", "\342\212\262"},
+    {"rlhar", "\342\207\214"},
+    {"lcub", "{"},
+    {"seswar", "\342\244\251"},
+    {"Tau", "\316\244"},
+    {"NotElement", "\342\210\211"},
+    {"plussim", "\342\250\246"},
+    {"ntrianglelefteq", "\342\213\254"},
+    {"updownarrow", "\342\206\225"},
+    {"mho", "\342\204\247"},
+    {"midast", "*"},
+    {"doublebarwedge", "\342\214\206"},
+    {"gneqq", "\342\211\251"},
+    {"DownTee", "\342\212\244"},
+    {"Scy", "\320\241"},
+    {"intcal", "\342\212\272"},
+    {"hArr", "\342\207\224"},
+    {"fltns", "\342\226\261"},
+    {"mldr", "\342\200\246"},
+    {"EmptySmallSquare", "\342\227\273"},
+    {"veebar", "\342\212\273"},
+    {"Jsercy", "\320\210"},
+    {"xotime", "\342\250\202"},
+    {"RightDownTeeVector", "\342\245\235"},
+    {"topcir", "\342\253\261"},
+    {"scnsim", "\342\213\251"},
+    {"NotLeftTriangleBar", "\342\247\217\314\270"},
+    {"Wedge", "\342\213\200"},
+    {"epar", "\342\213\225"},
+    {"iota", "\316\271"},
+    {"hookleftarrow", "\342\206\251"},
+    {"ggg", "\342\213\231"},
+    {"Racute", "\305\224"},
+    {"nsub", "\342\212\204"},
+    {"isinv", "\342\210\210"},
+    {"Aring", "\303\205"},
+    {"circledast", "\342\212\233"},
+    {"nvdash", "\342\212\254"},
+    {"Breve", "\313\230"},
+    {"isins", "\342\213\264"},
+    {"NotGreaterSlantEqual", "\342\251\276\314\270"},
+    {"ell", "\342\204\223"},
+    {"icy", "\320\270"},
+    {"wp", "\342\204\230"},
+    {"Cross", "\342\250\257"},
+    {"aopf", "\360\235\225\222"},
+    {"downharpoonleft", "\342\207\203"},
+    {"twoheadrightarrow", "\342\206\240"},
+    {"Pr", "\342\252\273"},
+    {"sscr", "\360\235\223\210"},
+    {"TRADE", "\342\204\242"},
+    {"timesd", "\342\250\260"},
+    {"rdsh", "\342\206\263"},
+    {"ngeqslant", "\342\251\276\314\270"},
+    {"RightUpTeeVector", "\342\245\234"},
+    {"yucy", "\321\216"},
+    {"iiota", "\342\204\251"},
+    {"Yuml", "\305\270"},
+    {"nharr", "\342\206\256"},
+    {"hscr", "\360\235\222\275"},
+    {"scsim", "\342\211\277"},
+    {"simeq", "\342\211\203"},
+    {"npart", "\342\210\202\314\270"},
+    {"RightUpVectorBar", "\342\245\224"},
+    {"nsqsupe", "\342\213\243"},
+    {"yopf", "\360\235\225\252"},
+    {"Omacr", "\305\214"},
+    {"plus", "+"},
+    {"lates", "\342\252\255\357\270\200"},
+    {"Kcy", "\320\232"},
+    {"lessgtr", "\342\211\266"},
+    {"Tilde", "\342\210\274"},
+    {"leftleftarrows", "\342\207\207"},
+    {"leftharpoondown", "\342\206\275"},
+    {"ouml", "\303\266"},
+    {"varpi", "\317\226"},
+    {"sacute", "\305\233"},
+    {"oplus", "\342\212\225"},
+    {"ncaron", "\305\210"},
+    {"bdquo", "\342\200\236"},
+    {"male", "\342\231\202"},
+    {"HumpDownHump", "\342\211\216"},
+    {"Lsh", "\342\206\260"},
+    {"setmn", "\342\210\226"},
+    {"inodot", "\304\261"},
+    {"Amacr", "\304\200"},
+    {"notinvc", "\342\213\266"},
+    {"die", "\302\250"},
+    {"notinva", "\342\210\211"},
+    {"Ufr", "\360\235\224\230"},
+    {"igrave", "\303\254"},
+    {"angmsd", "\342\210\241"},
+    {"gnap", "\342\252\212"},
+    {"barwed", "\342\214\205"},
+    {"rthree", "\342\213\214"},
+    {"malt", "\342\234\240"},
+    {"frac16", "\342\205\231"},
+    {"nlt", "\342\211\256"},
+    {"cscr", "\360\235\222\270"},
+    {"pointint", "\342\250\225"},
+    {"UpArrowDownArrow", "\342\207\205"},
+    {"SquareSupersetEqual", "\342\212\222"},
+    {"bsol", "\\"},
+    {"capbrcup", "\342\251\211"},
+    {"SucceedsTilde", "\342\211\277"},
+    {"loplus", "\342\250\255"},
+    {"DownLeftRightVector", "\342\245\220"},
+    {"bigcap", "\342\213\202"},
+    {"olarr", "\342\206\272"},
+    {"NJcy", "\320\212"},
+    {"ncy", "\320\275"},
+    {"CircleDot", "\342\212\231"},
+    {"Umacr", "\305\252"},
+    {"sqsube", "\342\212\221"},
+    {"nVDash", "\342\212\257"},
+    {"jopf", "\360\235\225\233"},
+    {"rhard", "\342\207\201"},
+    {"checkmark", "\342\234\223"},
+    {"ncup", "\342\251\202"},
+    {"triangleleft", "\342\227\203"},
+    {"maltese", "\342\234\240"},
+    {"rrarr", "\342\207\211"},
+    {"varsubsetneqq", "\342\253\213\357\270\200"},
+    {"upuparrows", "\342\207\210"},
+    {"pi", "\317\200"},
+    {"tscy", "\321\206"},
+    {"complexes", "\342\204\202"},
+    {"fallingdotseq", "\342\211\222"},
+    {"ubreve", "\305\255"},
+    {"bemptyv", "\342\246\260"},
+    {"Kopf", "\360\235\225\202"},
+    {"ultri", "\342\227\270"},
+    {"acute", "\302\264"},
+    {"NotSquareSuperset", "\342\212\220\314\270"},
+    {"ddotseq", "\342\251\267"},
+    {"rpar", ")"},
+    {"LeftVectorBar", "\342\245\222"},
+    {"egrave", "\303\250"},
+    {"DoubleLeftRightArrow", "\342\207\224"},
+    {"NotSupersetEqual", "\342\212\211"},
+    {"nle", "\342\211\260"},
+    {"rho", "\317\201"},
+    {"bfr", "\360\235\224\237"},
+    {"ldrdhar", "\342\245\247"},
+    {"models", "\342\212\247"},
+    {"zscr", "\360\235\223\217"},
+    {"LeftUpVectorBar", "\342\245\230"},
+    {"lAtail", "\342\244\233"},
+    {"ldquor", "\342\200\236"},
+    {"cylcty", "\342\214\255"},
+    {"lesges", "\342\252\223"},
+    {"rfloor", "\342\214\213"},
+    {"Theta", "\316\230"},
+    {"otimesas", "\342\250\266"},
+    {"bigwedge", "\342\213\200"},
+    {"timesb", "\342\212\240"},
+    {"ENG", "\305\212"},
+    {"ndash", "\342\200\223"},
+    {"rightarrow", "\342\206\222"},
+    {"leftrightsquigarrow", "\342\206\255"},
+    {"boxbox", "\342\247\211"},
+    {"ltrif", "\342\227\202"},
+    {"Udblac", "\305\260"},
+    {"Colon", "\342\210\267"},
+    {"blacksquare", "\342\226\252"},
+    {"ltquest", "\342\251\273"},
+    {"trpezium", "\342\217\242"},
+    {"bigtriangledown", "\342\226\275"},
+    {"dd", "\342\205\206"},
+    {"vBarv", "\342\253\251"},
+    {"amalg", "\342\250\277"},
+    {"rbrksld", "\342\246\216"},
+    {"hstrok", "\304\247"},
+    {"digamma", "\317\235"},
+    {"nlE", "\342\211\246\314\270"},
+    {"lsqb", "["},
+    {"horbar", "\342\200\225"},
+    {"Otilde", "\303\225"},
+    {"lneqq", "\342\211\250"},
+    {"LessLess", "\342\252\241"},
+    {"kcedil", "\304\267"},
+    {"pound", "\302\243"},
+    {"NotTildeTilde", "\342\211\211"},
+    {"sbquo", "\342\200\232"},
+    {"zeta", "\316\266"},
+    {"uscr", "\360\235\223\212"},
+    {"ulcorner", "\342\214\234"},
+    {"parallel", "\342\210\245"},
+    {"ccirc", "\304\211"},
+    {"boxv", "\342\224\202"},
+    {"Rightarrow", "\342\207\222"},
+    {"ogon", "\313\233"},
+    {"twixt", "\342\211\254"},
+    {"rightsquigarrow", "\342\206\235"},
+    {"nequiv", "\342\211\242"},
+    {"KJcy", "\320\214"},
+    {"lessdot", "\342\213\226"},
+    {"succsim", "\342\211\277"},
+    {"varsubsetneq", "\342\212\212\357\270\200"},
+    {"DiacriticalDoubleAcute", "\313\235"},
+    {"commat", "@"},
+    {"Rho", "\316\241"},
+    {"para", "\302\266"},
+    {"cent", "\302\242"},
+    {"ContourIntegral", "\342\210\256"},
+    {"lsim", "\342\211\262"},
+    {"napid", "\342\211\213\314\270"},
+    {"VerticalLine", "|"},
+    {"Union", "\342\213\203"},
+};
+
+static const int html_entity_displace[N_HTML_ENTITIES]= {
+    -2119, 1, -2118, -2117, -2115, -2112, 1, -2110,
+    -2107, 0, -2102, 0, 0, -2098, -2095, -2094,
+    -2093, 1, 0, 0, 0, 0, 0, 1,
+    1, -2092, -2091, 1, -2090, 1, -2087, 0,
+    1, 0, -2086, 0, 0, 0, 1, 0,
+    0, 0, -2083, 0, 0, -2079, -2072, 0,
+    1, -2071, -2069, 1, 1, -2068, -2063, 1,
+    0, -2061, -2057, -2053, -2051, -2048, 0, 0,
+    -2047, -2046, 1, -2042, 0, -2027, -2023, 0,
+    -2020, 1, 1, -2014, 0, 1, 1, -2013,
+    1, -2010, -2008, 2, 1, -2004, -2002, 0,
+    0, 1, 0, 0, 0, 1, 0, 0,
+    0, 2, -2001, -2000, -1999, 0, -1998, 2,
+    -1991, -1989, 1, 0, 0, 0, -1985, 0,
+    -1984, -1981, 0, 7, -1975, 0, 0, -1974,
+    1, 0, -1969, -1965, 0, 0, -1964, -1963,
+    0, 0, -1962, 0, 1, 0, 1, 0,
+    0, 1, -1959, 0, -1949, -1945, 0, 2,
+    -1939, 0, 0, -1938, -1929, -1928, 0, 3,
+    -1921, 0, 0, 1, -1920, 1, -1918, 0,
+    -1915, -1913, -1906, 1, 2, 4, 0, 0,
+    0, -1904, -1898, 0, 1, -1894, -1893, 0,
+    0, -1889, -1888, -1885, 0, -1883, 0, -1882,
+    -1880, -1879, -1877, -1876, 1, 2, -1874, -1867,
+    -1865, 1, 1, 1, 4, -1859, 0, -1857,
+    -1854, 0, 5, 0, 2, 0, 1, -1853,
+    1, 0, 1, 0, -1847, -1843, 4, -1842,
+    -1838, 0, -1837, 0, -1833, 1, 0, -1830,
+    1, 0, 0, 0, 3, 1, -1827, 1,
+    2, -1826, -1819, -1814, -1811, 1, 0, 0,
+    -1808, 0, 0, -1806, -1803, -1801, 0, -1800,
+    2, -1799, -1798, -1797, 0, 1, 2, 1,
+    0, 0, -1796, 0, 0, -1793, 1, -1791,
+    1, 0, 1, -1790, -1787, 1, 2, 0,
+    0, 0, 1, 0, 1, 3, -1786, -1785,
+    -1780, 0, -1779, 0, -1776, -1772, 0, 3,
+    0, 0, 1, 1, 0, 0, -1771, -1768,
+    0, 0, -1765, 0, -1764, -1762, -1761, 0,
+    -1760, -1759, 0, 0, -1753, -1744, -1737, 1,
+    0, -1735, 0, -1734, 0, -1733, 0, -1731,
+    0, -1729, 0, 0, 1, -1727, 0, -1725,
+    2, 0, -1723, 0, 1, -1721, 0, 0,
+    0, 2, 1, 1, 1, 4, 1, 0,
+    -1717, 0, -1715, 0, 1, 1, 0, -1709,
+    -1705, -1703, 6, -1702, 0, 0, 0, 0,
+    -1697, -1694, 0, -1691, 0, 0, -1690, -1689,
+    2, 1, 0, -1688, 0, 2, -1687, 0,
+    0, -1686, 4, 2, -1685, 1, -1683, 0,
+    1, 0, 2, -1681, 0, 0, -1679, 1,
+    4, 0, -1677, 1, 3, 0, -1676, 0,
+    1, 0, 0, 2, 0, 0, 1, 0,
+    0, -1675, -1672, -1671, -1669, 0, -1667, -1666,
+    0, 0, 1, 2, -1665, 0, -1663, 1,
+    2, 0, 0, 1, 0, 0, 0, -1660,
+    -1659, -1658, 0, 0, 0, 0, -1656, 2,
+    2, -1652, 0, 0, 0, 0, 2, -1651,
+    2, 0, -1647, 0, -1643, -1642, -1638, 0,
+    -1636, -1634, 2, 0, 0, 0, 2, -1632,
+    -1631, 0, 0, 1, 2, 0, 3, -1627,
+    -1624, 0, 0, -1622, 5, 3, 1, -1616,
+    0, 0, -1615, 1, 0, 1, 0, 0,
+    2, 0, -1608, -1607, -1605, -1599, -1597, 0,
+    -1596, 0, 7, 0, -1591, -1590, -1589, 0,
+    0, 3, 5, 0, 1, -1587, -1585, 0,
+    0, -1584, 0, -1570, 0, 1, 0, 6,
+    0, -1567, -1564, 5, -1563, 2, 0, 1,
+    0, 0, 0, -1562, 1, 0, 0, 0,
+    0, 1, 0, -1560, 2, -1557, -1552, 0,
+    -1551, 0, -1550, -1549, 0, 0, 1, 1,
+    0, 1, -1548, 3, 0, -1546, 0, 1,
+    -1544, 1, 0, 1, -1542, 1, 1, 2,
+    0, 0, 1, 1, -1540, -1539, -1536, -1532,
+    1, 0, -1528, 2, -1527, 0, -1525, 0,
+    2, 0, -1523, -1522, 4, 1, 2, -1521,
+    -1520, -1517, 0, 0, 0, 0, 1, 1,
+    0, 0, -1516, -1514, 0, 1, -1511, -1507,
+    0, 0, 0, 1, 0, 0, 2, 1,
+    -1503, -1497, 0, -1493, 0, 3, -1491, 1,
+    0, 0, 1, -1490, -1489, 0, 0, 3,
+    1, -1486, -1483, -1482, 0, 1, 0, 0,
+    -1480, 0, -1479, -1477, -1476, 0, -1474, 0,
+    -1471, 1, 1, 0, -1470, 6, 0, 0,
+    -1469, 3, 3, 4, -1468, 0, 2, -1466,
+    3, 0, 0, -1464, 0, 0, 0, 0,
+    0, -1462, -1460, 2, 0, 1, -1459, 0,
+    1, 0, 0, -1458, 1, 2, 5, 7,
+    2, 1, 0, -1457, 1, 2, 3, -1453,
+    3, -1451, 0, 1, 3, 1, -1449, -1448,
+    0, 1, -1441, 0, -1435, 5, 0, 0,
+    5, -1434, -1431, 0, -1430, 1, 0, -1428,
+    2, -1426, 1, -1420, 1, -1417, -1416, -1414,
+    1, -1412, 0, 0, 0, 1, -1411, -1406,
+    1, 4, -1405, 1, -1402, -1401, -1400, -1399,
+    3, 2, -1398, 0, 0, 0, 1, 2,
+    0, -1393, -1387, -1383, -1381, -1379, -1376, 0,
+    0, -1375, 0, 4, -1374, 0, 0, -1372,
+    -1369, 3, 2, 8, 0, -1367, 0, 1,
+    -1366, -1364, 3, 1, -1363, 2, -1362, -1358,
+    -1355, 5, -1354, -1353, -1349, 1, 1, 0,
+    1, 0, 3, 0, 1, -1346, -1344, -1342,
+    0, -1341, -1337, 0, 0, -1334, -1333, -1331,
+    -1328, -1326, 4, 0, 0, 1, -1321, -1318,
+    0, 1, 0, 0, -1317, -1316, -1314, -1306,
+    7, 0, -1303, 2, 7, 1, -1299, -1295,
+    0, 0, 0, -1294, -1293, 3, -1291, 1,
+    1, 3, -1289, -1282, 2, 0, -1281, -1279,
+    -1274, -1273, 4, 4, 7, 0, -1270, -1268,
+    0, -1267, 2, -1266, 2, -1265, -1262, 1,
+    1, 0, 0, 0, -1259, -1257, -1256, -1254,
+    -1253, 0, 0, 1, 3, 0, -1251, -1248,
+    -1244, 0, 0, -1241, 0, 1, -1239, -1234,
+    0, 2, 9, -1228, -1225, 0, -1214, 1,
+    -1212, 0, -1208, 3, 0, 0, 1, -1206,
+    5, 4, 0, 0, -1204, -1199, -1197, -1195,
+    -1189, 0, 0, -1188, 3, 1, 0, 0,
+    0, -1186, 2, -1183, 0, -1178, -1170, 2,
+    2, -1167, 2, 0, 2, 0, 3, -1158,
+    1, -1155, 2, 0, 4, 9, -1153, -1152,
+    -1147, 0, 0, 0, 1, 0, -1144, -1143,
+    0, 0, 0, -1140, 0, 0, -1136, -1134,
+    -1133, -1132, 2, 1, -1116, 0, -1113, 0,
+    0, 2, 1, 3, 0, -1111, 0, 0,
+    0, 0, 0, 0, -1108, -1106, 0, 1,
+    0, -1103, 0, 1, 0, 1, -1100, -1099,
+    -1098, 0, 1, -1093, 3, -1091, 0, 0,
+    7, -1088, -1084, 1, 0, 0, 0, 0,
+    -1083, -1080, 0, 0, -1075, 0, 1, 1,
+    -1073, -1072, 1, 0, 0, 1, 0, -1070,
+    0, -1069, 1, 0, -1068, -1067, 4, -1066,
+    7, 0, 0, 0, -1062, 0, 0, -1061,
+    -1053, 6, 0, 0, -1051, 1, 2, 0,
+    3, -1050, -1045, -1043, -1040, -1036, -1035, 0,
+    -1030, 5, -1027, -1026, 0, -1023, 0, -1020,
+    0, -1019, 3, 1, 1, 2, 0, 4,
+    1, -1014, 0, 4, -1013, 0, 9, 1,
+    0, -1008, -1006, -1004, -1000, 0, -996, -992,
+    -991, 2, -990, 0, 0, 2, -989, 2,
+    0, 0, 0, 0, 0, 0, 6, -986,
+    0, -982, -981, 3, -978, -977, 0, 5,
+    2, -976, 2, -974, 0, 0, -966, -965,
+    -964, -963, 1, 2, 3, -961, -960, 0,
+    8, 0, 0, 3, 0, 0, 0, 0,
+    -958, 0, 2, 0, 0, 1, 0, -956,
+    0, 1, 0, 1, -952, 0, 1, 0,
+    -948, 2, 1, 0, 4, 1, -947, -946,
+    0, 0, 0, -944, 0, 1, -943, 0,
+    1, 0, 0, 0, 5, 2, 0, -942,
+    3, -941, 0, -940, 0, 0, 0, 0,
+    0, 1, -935, -934, 0, 3, 0, 0,
+    0, -933, 0, -932, -931, -930, 2, 3,
+    -929, 1, 0, -928, -925, 0, 1, -923,
+    -921, 3, 12, 0, -920, -919, -911, 0,
+    2, -909, -906, -902, -901, 0, 7, 0,
+    -898, -897, 1, 1, 6, 1, -896, 0,
+    -895, 3, -893, -890, 5, 0, 0, 0,
+    0, -888, -884, -883, 0, -881, -879, 0,
+    2, 0, 2, -877, 2, -875, -874, 1,
+    0, -873, 0, 0, 0, 0, -872, 0,
+    -870, -869, -860, 3, 15, 0, -856, 1,
+    2, 0, 1, 0, 2, 5, -855, -854,
+    0, -847, -845, -843, 0, -840, 0, 0,
+    -836, 0, -835, 2, -834, 0, 0, 0,
+    -832, -827, 8, -823, -821, -819, -816, 1,
+    3, -814, 0, 0, 0, 2, -811, 0,
+    6, 1, 1, 3, -809, 0, 2, 0,
+    1, 2, 0, -801, -800, -797, -791, -781,
+    3, 1, -780, -772, -771, 0, 5, 0,
+    0, 0, -769, 0, 1, -767, -762, -760,
+    -755, -754, -750, 0, 0, 0, 0, 1,
+    0, -747, -742, -737, 0, 0, -735, 0,
+    -732, 7, 0, 7, 0, -730, 0, 3,
+    0, 1, -729, 11, 0, 2, -728, 2,
+    0, 1, 0, 3, -724, -722, 0, 0,
+    -721, -718, 4, -717, 0, 0, 1, 0,
+    6, 0, 0, -711, 0, 0, 0, 0,
+    0, 6, -709, -708, 7, 0, 0, 0,
+    -707, -704, 0, -702, 0, 0, -701, -699,
+    0, 0, 4, 0, 0, 3, 2, 0,
+    0, 1, 0, 0, 0, -697, -694, 1,
+    2, 5, -692, 4, -687, 1, -685, 0,
+    0, 0, -672, 0, 5, -671, -670, 0,
+    -668, 0, 0, 0, 0, 1, 0, -666,
+    1, 3, 3, 7, -655, 0, 2, -654,
+    -653, -652, 3, -651, 3, -641, 0, 0,
+    -638, 0, -633, 0, 1, 0, -632, -630,
+    0, -628, -625, -624, -620, 0, 0, 0,
+    -619, 1, 4, -617, 0, 0, -613, -601,
+    -598, -597, 5, 0, 17, 0, -596, 3,
+    1, -595, -590, -589, 0, 0, -588, 1,
+    3, 0, 0, 0, -584, 0, 0, 4,
+    0, 0, 0, -579, 0, 15, -577, 0,
+    0, 0, 0, 0, -576, 0, 8, 0,
+    15, 5, -575, -574, 1, 0, 1, 1,
+    0, 0, 0, 0, 21, -573, -569, 2,
+    0, -564, -563, 3, -559, 0, 0, -557,
+    -552, -547, 9, -545, 0, 8, 0, 0,
+    0, 0, -540, 0, 0, 0, -538, 0,
+    -536, -533, -530, 2, -529, 2, -527, -526,
+    0, 0, -525, -523, 0, -521, 2, 3,
+    -517, 0, 1, -513, 3, 2, 2, 0,
+    -512, -501, 3, 0, 0, 5, 9, 0,
+    0, -488, 0, -485, 6, 13, 0, 1,
+    -483, 0, -480, 1, 0, 1, -475, 0,
+    0, 0, 0, -471, -469, 0, 0, 3,
+    0, 0, -467, 0, 0, 0, 1, -464,
+    0, 2, 0, 0, 0, 2, -462, -458,
+    -452, 0, 0, -446, 0, 3, 0, 7,
+    -442, 0, -441, 1, 0, 4, 0, 1,
+    0, -439, 0, -436, 0, -432, 5, 0,
+    0, -430, 0, 0, -429, -427, 2, -426,
+    6, -424, -419, -417, 0, -414, 1, 0,
+    0, -413, 0, 0, 0, 2, -412, 0,
+    -411, 0, 0, -410, 2, -409, -408, 2,
+    -407, 0, -406, 9, 16, 0, 0, 0,
+    5, 3, -400, 0, -398, 2, 0, -392,
+    0, 7, -391, 6, 0, 0, 0, -387,
+    -386, 0, 0, -382, 0, 2, 0, 0,
+    0, -381, 4, 0, 0, 0, -379, -378,
+    0, 15, 0, 0, 1, -375, 0, -365,
+    -358, 0, 0, -357, 4, -356, -351, -348,
+    -344, -340, 0, -338, 0, -335, -328, 1,
+    -325, 0, 0, -320, 2, 4, -317, -312,
+    0, 0, -311, 0, 0, 0, 0, -310,
+    -309, 3, 0, 0, -307, 2, 1, 0,
+    0, 0, 0, -301, 0, 0, -299, 2,
+    0, -298, 0, 2, -295, 0, -289, 0,
+    -284, 0, 0, -277, 1, 0, -274, -267,
+    11, -264, 2, -255, 0, -254, 0, -249,
+    -245, -244, 0, 0, -241, -240, -236, -235,
+    -228, 0, 1, -227, 0, 3, 0, -226,
+    -225, 0, 1, -222, 4, 1, 0, -221,
+    0, 0, -220, 0, 4, -219, 0, 2,
+    -214, 0, 0, 0, -213, -211, 0, -208,
+    0, 5, 15, 1, -206, -201, -199, -198,
+    0, 3, 0, 0, 1, 22, -197, 0,
+    2, -196, 6, 0, 0, 2, 0, 2,
+    6, 0, 9, -193, -192, 1, -185, 3,
+    1, 0, 7, 2, 0, 1, 0, 0,
+    3, 0, 0, 5, 0, 0, -184, 0,
+    -183, 3, 0, 11, 2, 1, -175, -174,
+    2, -173, -169, -166, -160, 0, 0, 0,
+    -158, -157, -156, 6, 2, 1, 0, 1,
+    0, -155, 0, -154, 0, -152, 0, -151,
+    7, 0, 0, 1, 2, -150, 6, -149,
+    13, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, -148, -143, -139, 0, 0, 0,
+    -138, 0, 0, -129, 0, 2, -127, 4,
+    0, 0, 2, -126, 0, 1, 0, 0,
+    0, 1, -124, 0, -123, -120, 0, -118,
+    0, 0, 0, -116, 1, -113, -111, 0,
+    -108, 0, -107, 1, 3, 0, 0, -106,
+    0, 1, 0, 3, 0, 4, 0, 6,
+    -103, -99, 1, 0, 1, -98, 3, 1,
+    -97, -96, 10, 0, 4, 0, 0, 0,
+    0, 0, 3, 4, -93, 0, 0, 0,
+    0, 0, -92, -88, 0, -77, -76, -75,
+    -74, -73, 6, 0, 4, -70, -68, 2,
+    1, 2, 9, 1, 4, 0, 1, -64,
+    1, -63, -61, 0, -59, 2, -54, -53,
+    0, -52, 0, 0, 0, -49, 0, -43,
+    0, 0, 1, 0, 1, -42, -41, 0,
+    0, 0, 0, 0, -30, -23, -20, -18,
+    2, 0, 4, 0, -14, 0, 0, 0,
+    2, 0, 0, 3, -8, -4, 0, 1,
+    1, 6, 2, 9, 0, 0, 0, -3,
+    0, 14, 1, -1, 4,
+};
+
+static inline unsigned int
+html_entity_hash (unsigned int d, const char* s, int n) {
+  if (d == 0) d= 0x01000193;
+  for (int i= 0; i < n; i++)
+    d= (d * 0x01000193) ^ ((unsigned int) (unsigned char) s[i]);
+  return d;
+}
+
+const char*
+html_entity_value (const char* s, int n) {
+  unsigned int h= html_entity_hash (0, s, n) % N_HTML_ENTITIES;
+  int          d= html_entity_displace[h];
+  unsigned int i= d < 0 ? (unsigned int) (-d - 1)
+                        : html_entity_hash (d, s, n) % N_HTML_ENTITIES;
+  const char*  r= html_entity_table[i].name;
+  if (strncmp (r, s, n) != 0 || r[n] != '\0') return NULL;
+  return html_entity_table[i].value;
+}
+
+const char*
+xml_entity_value (const char* s, int n) {
+  if (n == 2 && s[1] == 't') {
+    if (s[0] == 'l') return "<";
+    if (s[0] == 'g') return ">";
+  }
+  else if (n == 3 && strncmp (s, "amp", 3) == 0) return "&";
+  else if (n == 4 && strncmp (s, "quot", 4) == 0) return "\42";
+  else if (n == 4 && strncmp (s, "apos", 4) == 0) return "'";
+  return NULL;
+}
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+###############################################################################
+# MODULE     : xml_entities.py
+# DESCRIPTION: generate the perfect hash table of Html5 named entities
+# COPYRIGHT  : (C) 2024  Darcy Shen
+###############################################################################
+# This software falls under the GNU general public license version 3 or later.
+# It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+# in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+###############################################################################
+#
+# Usage: python3 xml_entities.py > xml_entities.cpp
+#
+# The entity list is the one of the WHATWG Html standard, as shipped with
+# the python standard library. Names are stored without the trailing ';'.
+
+from html.entities import html5
+
+def fnv (d, key):
+    if d == 0: d = 0x01000193
+    for c in key.encode ("utf-8"):
+        d = ((d * 0x01000193) ^ c) & 0xffffffff
+    return d
+
+def c_string (s):
+    r = ""
+    for c in s.encode ("utf-8"):
+        if c == 34 or c == 92: r += "\\" + chr (c)
+        elif 32 <= c < 127: r += chr (c)
+        else: r += "\\%03o" % c
+    return '"' + r + '"'
+
+entities = {}
+for name, value in html5.items ():
+    entities[name.rstrip (";")] = value
+keys = sorted (entities)
+n = len (keys)
+
+buckets = [[] for i in range (n)]
+for k in keys: buckets[fnv (0, k) % n].append (k)
+buckets.sort (key = len, reverse = True)
+
+displace = [0] * n
+slots = [None] * n
+for b in buckets:
+    if len (b) <= 1: break
+    d = 1
+    while True:
+        taken = [fnv (d, k) % n for k in b]
+        if len (set (taken)) == len (b) and all (slots[i] is None for i in taken):
+            break
+        d += 1
+    displace[fnv (0, b[0]) % n] = d
+    for k, i in zip (b, taken): slots[i] = k
+free = [i for i in range (n) if slots[i] is None]
+for b in buckets:
+    if len (b) != 1: continue
+    i = free.pop ()
+    displace[fnv (0, b[0]) % n] = -i - 1
+    slots[i] = b[0]
+
+print ("""
+/******************************************************************************
+ * MODULE     : xml_entities.cpp
+ * DESCRIPTION: perfect hash table of Html5 named entities
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+// This file is generated by xml_entities.py; do not edit it by hand.
+
+#include "xml.hpp"
+
+#include <string.h>
+
+#define N_HTML_ENTITIES %d
+
+struct html_entity_entry {
+  const char* name;
+  const char* value;
+};
+
+static const html_entity_entry html_entity_table[N_HTML_ENTITIES]= {""" % n)
+for k in slots:
+    print ("    {%s, %s}," % (c_string (k), c_string (entities[k])))
+print ("};\n")
+print ("static const int html_entity_displace[N_HTML_ENTITIES]= {")
+for i in range (0, n, 8):
+    print ("    " + " ".join ("%d," % d for d in displace[i:i+8]))
+print ("""};
+
+static inline unsigned int
+html_entity_hash (unsigned int d, const char* s, int n) {
+  if (d == 0) d= 0x01000193;
+  for (int i= 0; i < n; i++)
+    d= (d * 0x01000193) ^ ((unsigned int) (unsigned char) s[i]);
+  return d;
+}
+
+const char*
+html_entity_value (const char* s, int n) {
+  unsigned int h= html_entity_hash (0, s, n) % N_HTML_ENTITIES;
+  int          d= html_entity_displace[h];
+  unsigned int i= d < 0 ? (unsigned int) (-d - 1)
+                        : html_entity_hash (d, s, n) % N_HTML_ENTITIES;
+  const char*  r= html_entity_table[i].name;
+  if (strncmp (r, s, n) != 0 || r[n] != '\\0') return NULL;
+  return html_entity_table[i].value;
+}
+
+const char*
+xml_entity_value (const char* s, int n) {
+  if (n == 2 && s[1] == 't') {
+    if (s[0] == 'l') return "<";
+    if (s[0] == 'g') return ">";
+  }
+  else if (n == 3 && strncmp (s, "amp", 3) == 0) return "&";
+  else if (n == 4 && strncmp (s, "quot", 4) == 0) return "\\42";
+  else if (n == 4 && strncmp (s, "apos", 4) == 0) return "'";
+  return NULL;
+}""")
@@ -163,6 +163,19 @@ function main()
                 cpp_name = "mem_used",
                 ret_type = "int"
             },
+            {
+                scm_name = "allocation-report",
+                cpp_name = "alloc_report",
+                ret_type = "scheme_tree"
+            },
+            {
+                scm_name = "allocation-sampling",
+                cpp_name = "alloc_set_sampling",
+                ret_type = "void",
+                arg_list = {
+                    "int"
+                }
+            },
             {
                 scm_name = "bench-print-all",
                 cpp_name = "bench_print_all",
@@ -1476,6 +1489,23 @@ function main()
                     "url"
                 }
             },
+            {
+                scm_name = "buffer-verbatim-window",
+                cpp_name = "buffer_verbatim_window",
+                ret_type = "int",
+                arg_list = {
+                    "url"
+                }
+            },
+            {
+                scm_name = "buffer-verbatim-page",
+                cpp_name = "buffer_verbatim_page",
+                ret_type = "bool",
+                arg_list = {
+                    "url",
+                    "int"
+                }
+            },
             {
                 scm_name = "tree-import-loaded",
                 cpp_name = "import_loaded_tree",
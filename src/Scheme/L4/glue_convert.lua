@@ -193,6 +193,22 @@ function main()
                     "url"
                 }
             },
+            {
+                scm_name = "index-update",
+                cpp_name = "index_update",
+                ret_type = "void",
+                arg_list = {
+                    "url"
+                }
+            },
+            {
+                scm_name = "index-search",
+                cpp_name = "index_search",
+                ret_type = "scheme_tree",
+                arg_list = {
+                    "string"
+                }
+            },
         }
     }
 end
@@ -20,6 +20,7 @@
 #include "object_l5.hpp"
 
 #include "Freetype/tt_tools.hpp"
+#include "alloc_stats.hpp"
 #include "boxes.hpp"
 #include "editor.hpp"
 #include "iterator.hpp"
@@ -23,6 +23,14 @@ function main()
                     "string"
                 }
             },
+            {
+                scm_name = "parse-html-file",
+                cpp_name = "parse_html_file",
+                ret_type = "scheme_tree",
+                arg_list = {
+                    "url"
+                }
+            },
             {
                 scm_name = "clean-html",
                 cpp_name = "clean_html",
@@ -39,6 +47,24 @@ function main()
                     "content"
                 }
             },
+            {
+                scm_name = "html-save",
+                cpp_name = "save_html",
+                ret_type = "bool",
+                arg_list = {
+                    "url",
+                    "scheme_tree"
+                }
+            },
+            {
+                scm_name = "html-split-pages",
+                cpp_name = "html_split_pages",
+                ret_type = "tree",
+                arg_list = {
+                    "content",
+                    "string"
+                }
+            },
             {
                 scm_name = "retrieve-mathjax",
                 cpp_name = "retrieve_mathjax",
@@ -31,6 +31,11 @@ function main()
                     "string"
                 }
             },
+            {
+                scm_name = "latex-reset-pieces",
+                cpp_name = "latex_reset_pieces",
+                ret_type = "void"
+            },
             {
                 scm_name = "latex->texmacs",
                 cpp_name = "latex_to_tree",
@@ -48,6 +53,14 @@ function main()
                     "bool"
                 }
             },
+            {
+                scm_name = "set-post-pass-skipping",
+                cpp_name = "set_post_pass_skipping",
+                ret_type = "void",
+                arg_list = {
+                    "bool"
+                }
+            },
             {
                 scm_name = "latex-class-document->texmacs",
                 cpp_name = "latex_class_document_to_tree",
@@ -73,6 +73,14 @@ function main()
                     "string"
                 }
             },
+            {
+                scm_name = "parse-xml-file",
+                cpp_name = "parse_xml_file",
+                ret_type = "scheme_tree",
+                arg_list = {
+                    "url"
+                }
+            },
         }
     }
 end
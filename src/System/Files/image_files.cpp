@@ -387,12 +387,12 @@ svg_image_size (url image, int& w, int& h) {
   string content;
   bool   err= tm_load_string (image, content, false);
   if (!err) {
-    tree   t         = parse_xml (content);
-    tree   result    = find_first_element_by_name (t, "svg");
-    string width     = get_attr_from_element (result, "width", "");
-    string height    = get_attr_from_element (result, "height", "");
-    int    try_width = parse_xml_length (width);
-    int    try_height= parse_xml_length (height);
+    xml_index idx       = parse_xml_index (content);
+    tree      result    = find_first_element_by_name (idx, "svg");
+    string    width     = get_attr_from_element (result, "width", "");
+    string    height    = get_attr_from_element (result, "height", "");
+    int       try_width = parse_xml_length (width);
+    int       try_height= parse_xml_length (height);
     if (try_width > 0) w= try_width;
     if (try_height > 0) h= try_height;
   }
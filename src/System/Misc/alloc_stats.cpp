@@ -0,0 +1,128 @@
+
+/******************************************************************************
+ * MODULE     : alloc_stats.cpp
+ * DESCRIPTION: accounting of allocations per subsystem
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include "alloc_stats.hpp"
+#include "archiver.hpp"
+#include "fast_alloc.hpp"
+#include "picture.hpp"
+#include "tm_timer.hpp"
+
+extern tree the_et;
+
+long alloc_live[ALLOC_SUBSYSTEMS] = {0};
+long alloc_total[ALLOC_SUBSYSTEMS]= {0};
+
+// Trees and strings are only measured inside the edit tree, see below
+static const char* alloc_names[ALLOC_SUBSYSTEMS]= {
+    "edit-tree-nodes", "edit-tree-atoms", "box", "font", "picture",
+    "archiver"};
+
+/******************************************************************************
+ * Measuring the subsystems
+ ******************************************************************************/
+
+// Trees and strings are allocated by the kernel libraries, so we measure
+// the nodes and the atom sizes of the edit tree which holds all buffers.
+static void
+alloc_measure (tree t, alloc_snapshot& s) {
+  s.live[ALLOC_TREE]++;
+  if (is_atomic (t)) {
+    s.live[ALLOC_STRING]++;
+    s.bytes[ALLOC_STRING]+= N (t->label);
+  }
+  else
+    for (int i= 0; i < N (t); i++)
+      alloc_measure (t[i], s);
+}
+
+alloc_snapshot
+alloc_current () {
+  alloc_snapshot s;
+  s.time= (long) texmacs_time ();
+  s.heap= (long) mem_used ();
+  for (int i= 0; i < ALLOC_SUBSYSTEMS; i++) {
+    s.live[i] = alloc_live[i];
+    s.total[i]= alloc_total[i];
+    s.bytes[i]= 0;
+  }
+  alloc_measure (the_et, s);
+  s.total[ALLOC_TREE]  = s.live[ALLOC_TREE];
+  s.total[ALLOC_STRING]= s.live[ALLOC_STRING];
+  long nr_pictures= 0, picture_bytes= 0;
+  picture_cache_statistics (nr_pictures, picture_bytes);
+  s.live[ALLOC_PICTURE] = s.total[ALLOC_PICTURE]= nr_pictures;
+  s.bytes[ALLOC_PICTURE]= picture_bytes;
+  s.live[ALLOC_ARCHIVER]= s.total[ALLOC_ARCHIVER]= archived_modifications ();
+  return s;
+}
+
+/******************************************************************************
+ * Sampling during long sessions
+ ******************************************************************************/
+
+static int            alloc_interval= 0;
+static int            alloc_nr_samples= 0;
+static alloc_snapshot alloc_samples[ALLOC_MAX_SAMPLES];
+
+void
+alloc_set_sampling (int interval) {
+  alloc_interval  = max (interval, 0);
+  alloc_nr_samples= 0;
+}
+
+void
+alloc_sample () {
+  if (alloc_interval == 0) return;
+  long now= (long) texmacs_time ();
+  if (alloc_nr_samples > 0) {
+    int last= (alloc_nr_samples - 1) % ALLOC_MAX_SAMPLES;
+    if (now - alloc_samples[last].time < alloc_interval) return;
+  }
+  alloc_samples[alloc_nr_samples % ALLOC_MAX_SAMPLES]= alloc_current ();
+  alloc_nr_samples++;
+}
+
+/******************************************************************************
+ * Reports
+ ******************************************************************************/
+
+static scheme_tree
+alloc_report (alloc_snapshot s) {
+  scheme_tree r= tuple (as_string (s.time), as_string (s.heap));
+  for (int i= 0; i < ALLOC_SUBSYSTEMS; i++)
+    r << tuple (alloc_names[i], as_string (s.live[i]), as_string (s.total[i]),
+                as_string (s.bytes[i]));
+  return r;
+}
+
+scheme_tree
+alloc_report () {
+  scheme_tree r= tuple (alloc_report (alloc_current ()));
+  int start= max (alloc_nr_samples - ALLOC_MAX_SAMPLES, 0);
+  for (int i= start; i < alloc_nr_samples; i++)
+    r << alloc_report (alloc_samples[i % ALLOC_MAX_SAMPLES]);
+  return r;
+}
+
+void
+alloc_print_delta (string task, alloc_snapshot before) {
+  alloc_snapshot after= alloc_current ();
+  cout << "Allocations during " << task << ": "
+       << (after.heap - before.heap) << " bytes\n";
+  for (int i= 0; i < ALLOC_SUBSYSTEMS; i++) {
+    long live = after.live[i] - before.live[i];
+    long total= after.total[i] - before.total[i];
+    long bytes= after.bytes[i] - before.bytes[i];
+    if (live == 0 && total == 0 && bytes == 0) continue;
+    cout << "  " << alloc_names[i] << ": " << live << " live, " << total
+         << " allocated, " << bytes << " bytes\n";
+  }
+}
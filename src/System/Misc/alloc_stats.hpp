@@ -0,0 +1,68 @@
+
+/******************************************************************************
+ * MODULE     : alloc_stats.hpp
+ * DESCRIPTION: accounting of allocations per subsystem
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#ifndef ALLOC_STATS_H
+#define ALLOC_STATS_H
+
+#include "tree.hpp"
+
+#define ALLOC_MAX_SAMPLES 256
+
+enum {
+  ALLOC_TREE,
+  ALLOC_STRING,
+  ALLOC_BOX,
+  ALLOC_FONT,
+  ALLOC_PICTURE,
+  ALLOC_ARCHIVER,
+  ALLOC_SUBSYSTEMS
+};
+
+// Objects whose constructors and destructors are hooked are counted here;
+// the other subsystems are measured on demand, by inspecting their caches.
+extern long alloc_live[ALLOC_SUBSYSTEMS];
+extern long alloc_total[ALLOC_SUBSYSTEMS];
+
+inline void
+alloc_hook_new (int which) {
+  alloc_live[which]++;
+  alloc_total[which]++;
+}
+inline void
+alloc_hook_delete (int which) {
+  alloc_live[which]--;
+}
+
+struct alloc_snapshot {
+  long time;
+  long heap;
+  long live[ALLOC_SUBSYSTEMS];
+  long total[ALLOC_SUBSYSTEMS];
+  long bytes[ALLOC_SUBSYSTEMS];
+};
+
+alloc_snapshot alloc_current ();
+void           alloc_set_sampling (int interval);
+void           alloc_sample ();
+scheme_tree    alloc_report ();
+void           alloc_print_delta (string task, alloc_snapshot before);
+
+// Prints the allocations made during its lifetime, e.g. around a QBENCHMARK
+class alloc_watch {
+  string         task;
+  alloc_snapshot start;
+
+public:
+  inline alloc_watch (string task2) : task (task2), start (alloc_current ()) {}
+  inline ~alloc_watch () { alloc_print_delta (task, start); }
+};
+
+#endif // defined ALLOC_STATS_H
@@ -10,8 +10,10 @@
  ******************************************************************************/
 
 #include "data_cache.hpp"
+#include "analyze.hpp"
 #include "file.hpp"
 #include "iterator.hpp"
+#include "merge_sort.hpp"
 #include "sys_utils.hpp"
 #include "tm_file.hpp"
 #include "tree_helper.hpp"
@@ -24,17 +26,49 @@ using moebius::data::tree_to_scheme;
  * Caching routines
  ******************************************************************************/
 
+#define CACHE_PARTITIONS 16
+#define CACHE_BINARY_MAGIC "TMCACHE"
+#define CACHE_BINARY_VERSION 1
+
 static hashmap<tree, tree>   cache_data ("?");
 static hashset<string>       cache_loaded;
 static hashset<string>       cache_changed;
+static hashset<string>       cache_dirty;
 static hashmap<string, bool> cache_valid (false);
+static hashmap<string, url>  cache_legacy (url_none ());
+
+static int
+cache_partition (tree key) {
+  // NOTE: the partition must not depend on the labels of compound trees,
+  // since their numbering may change from one session to another
+  string s= is_atomic (key) ? key->label : tree_to_scheme (key);
+  return (int) (((unsigned int) hash (s)) % CACHE_PARTITIONS);
+}
+
+static string
+cache_partition_name (string buffer, int part) {
+  return buffer * ":" * as_string (part);
+}
+
+static void
+cache_declare_changed (string buffer, tree key) {
+  cache_changed->insert (buffer);
+  cache_dirty->insert (cache_partition_name (buffer, cache_partition (key)));
+}
+
+static void
+cache_declare_all_changed (string buffer) {
+  cache_changed->insert (buffer);
+  for (int i= 0; i < CACHE_PARTITIONS; i++)
+    cache_dirty->insert (cache_partition_name (buffer, i));
+}
 
 void
 cache_set (string buffer, tree key, tree t) {
   tree ckey= tuple (buffer, key);
   if (cache_data[ckey] != t) {
     cache_data (ckey)= t;
-    cache_changed->insert (buffer);
+    cache_declare_changed (buffer, key);
   }
 }
 
@@ -42,7 +76,7 @@ void
 cache_reset (string buffer, tree key) {
   tree ckey= tuple (buffer, key);
   cache_data->reset (ckey);
-  cache_changed->insert (buffer);
+  cache_declare_changed (buffer, key);
 }
 
 bool
@@ -139,6 +173,136 @@ do_cache_stat_fail (string name) {
                                  starts (name, texmacs_doc_path_string));
 }
 
+/******************************************************************************
+ * Binary encoding of the cache partitions
+ ******************************************************************************/
+
+static void
+cache_write_int (string& r, int i) {
+  unsigned int x= (unsigned int) i;
+  while (x >= 128) {
+    r << (char) ((x & 127) | 128);
+    x>>= 7;
+  }
+  r << (char) x;
+}
+
+static bool
+cache_read_int (string s, int& pos, int& i) {
+  unsigned int x= 0;
+  for (int shift= 0; shift < 32; shift+= 7) {
+    if (pos >= N (s)) return false;
+    unsigned char c= (unsigned char) s[pos++];
+    x|= ((unsigned int) (c & 127)) << shift;
+    if ((c & 128) == 0) {
+      i= (int) x;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void
+cache_write_string (string& r, string s) {
+  cache_write_int (r, N (s));
+  r << s;
+}
+
+static bool
+cache_read_string (string s, int& pos, string& r) {
+  int n;
+  if (!cache_read_int (s, pos, n) || n < 0 || pos + n > N (s)) return false;
+  r  = s (pos, pos + n);
+  pos= pos + n;
+  return true;
+}
+
+static void
+cache_write_tree (string& r, tree t) {
+  if (is_atomic (t)) {
+    r << '\0';
+    cache_write_string (r, t->label);
+  }
+  else {
+    r << '\1';
+    cache_write_string (r, as_string (L (t)));
+    cache_write_int (r, N (t));
+    for (int i= 0; i < N (t); i++)
+      cache_write_tree (r, t[i]);
+  }
+}
+
+static bool
+cache_read_tree (string s, int& pos, tree& t) {
+  if (pos >= N (s)) return false;
+  char   kind= s[pos++];
+  string label;
+  if (!cache_read_string (s, pos, label)) return false;
+  if (kind == '\0') {
+    t= tree (label);
+    return true;
+  }
+  int n;
+  if (kind != '\1' || !cache_read_int (s, pos, n) || n < 0) return false;
+  t= tree (make_tree_label (label), n);
+  for (int i= 0; i < n; i++)
+    if (!cache_read_tree (s, pos, t[i])) return false;
+  return true;
+}
+
+static url
+cache_partition_file (string buffer, int part) {
+  return get_tm_cache_path () * url (buffer * "-" * as_string (part) * ".bin");
+}
+
+static bool
+cache_load_partition (string buffer, int part, array<tree>& entries) {
+  url    cache_file= cache_partition_file (buffer, part);
+  string s;
+  if (load_string (cache_file, s, false)) return false;
+  string magic= CACHE_BINARY_MAGIC;
+  int    pos  = N (magic), version, nr_part, nr;
+  if (!starts (s, magic)) return false;
+  if (!cache_read_int (s, pos, version) || version != CACHE_BINARY_VERSION)
+    return false;
+  if (!cache_read_int (s, pos, nr_part) || nr_part != part) return false;
+  if (!cache_read_int (s, pos, nr)) return false;
+  for (int i= 0; i < nr; i++) {
+    tree key, val;
+    if (!cache_read_tree (s, pos, key)) return false;
+    if (!cache_read_tree (s, pos, val)) return false;
+    if (cache_partition (key) != part) {
+      // can only happen when the partitioning changes; move the entry
+      cache_dirty->insert (cache_partition_name (buffer, part));
+      cache_dirty->insert (
+          cache_partition_name (buffer, cache_partition (key)));
+      cache_changed->insert (buffer);
+    }
+    entries << key << val;
+  }
+  return true;
+}
+
+static bool
+cache_load_binary (string buffer) {
+  // Only dirty partitions are saved, so missing partitions are empty;
+  // corrupted partitions are dropped and written again on the next save
+  bool found= false;
+  for (int part= 0; part < CACHE_PARTITIONS; part++) {
+    if (!exists (cache_partition_file (buffer, part))) continue;
+    array<tree> entries;
+    found= true;
+    if (!cache_load_partition (buffer, part, entries)) {
+      cache_changed->insert (buffer);
+      cache_dirty->insert (cache_partition_name (buffer, part));
+      continue;
+    }
+    for (int i= 0; i + 1 < N (entries); i+= 2)
+      cache_data (tuple (buffer, entries[i]))= entries[i + 1];
+  }
+  return found;
+}
+
 /******************************************************************************
  * Saving and loading the cache to/from disk
  ******************************************************************************/
@@ -146,52 +310,88 @@ do_cache_stat_fail (string name) {
 void
 cache_save (string buffer) {
   if (cache_changed->contains (buffer)) {
-    url            cache_file= get_tm_cache_path () * url (buffer);
-    string         cached;
+    array<string> body (CACHE_PARTITIONS);
+    array<int>    count (CACHE_PARTITIONS);
+    array<bool>   dirty (CACHE_PARTITIONS);
+    for (int part= 0; part < CACHE_PARTITIONS; part++) {
+      body[part] = "";
+      count[part]= 0;
+      dirty[part]= cache_dirty->contains (cache_partition_name (buffer, part));
+    }
     iterator<tree> it= iterate (cache_data);
-    cached << "(tuple\n";
     while (it->busy ()) {
       tree ckey= it->next ();
       if (ckey[0] == buffer) {
-        cached << tree_to_scheme (ckey[1]) << " ";
-        cached << tree_to_scheme (cache_data[ckey]) << "\n";
+        int part= cache_partition (ckey[1]);
+        if (dirty[part]) {
+          cache_write_tree (body[part], ckey[1]);
+          cache_write_tree (body[part], cache_data[ckey]);
+          count[part]++;
+        }
       }
     }
-    cached << ")";
-    (void) save_string (cache_file, cached);
+    bool error= false;
+    for (int part= 0; part < CACHE_PARTITIONS; part++)
+      if (dirty[part]) {
+        string cached= CACHE_BINARY_MAGIC;
+        cache_write_int (cached, CACHE_BINARY_VERSION);
+        cache_write_int (cached, part);
+        cache_write_int (cached, count[part]);
+        cached << body[part];
+        if (save_string (cache_partition_file (buffer, part), cached))
+          error= true;
+        else cache_dirty->remove (cache_partition_name (buffer, part));
+      }
+    if (error) return;
     cache_changed->remove (buffer);
   }
+  if (cache_legacy->contains (buffer)) {
+    // the cache in scheme format is only removed once it has been upgraded
+    remove (cache_legacy[buffer]);
+    cache_legacy->reset (buffer);
+  }
+}
+
+static bool
+cache_load_scheme (url cache_file, string buffer) {
+  if (!exists (cache_file)) return false;
+  tree t= scheme_to_tree (string_load (cache_file));
+  for (int i= 0; i < N (t) - 1; i+= 2)
+    cache_data (tuple (buffer, t[i]))= t[i + 1];
+  return true;
 }
 
 static void
 cache_init (string buffer) {
   if (buffer == "font_cache.scm" || buffer == "font_basename.scm") {
     url cache_file= url ("$TEXMACS_PATH/fonts/") * buffer;
-    if (exists (cache_file)) {
-      tree t= scheme_to_tree (string_load (cache_file));
-      for (int i= 0; i < N (t) - 1; i+= 2)
-        cache_data (tuple (buffer, t[i]))= t[i + 1];
-    }
+    if (cache_load_scheme (cache_file, buffer))
+      cache_declare_all_changed (buffer);
   }
 }
 
 void
 cache_load (string buffer) {
   if (!cache_loaded->contains (buffer)) {
-    url cache_file= get_tm_cache_path () * url (buffer);
-    // cout << "cache_file "<< cache_file << LF;
-    if (exists (cache_file)) {
-      tree t= scheme_to_tree (string_load (cache_file));
-      for (int i= 0; i < N (t) - 1; i+= 2)
-        cache_data (tuple (buffer, t[i]))= t[i + 1];
-    }
-    else {
-      cache_init (buffer);
+    // cout << "cache_file "<< buffer << LF;
+    if (!cache_load_binary (buffer)) {
+      // Upgrade from caches in scheme format or create the initial cache
+      url cache_file= get_tm_cache_path () * url (buffer);
+      if (cache_load_scheme (cache_file, buffer)) {
+        cache_declare_all_changed (buffer);
+        cache_legacy (buffer)= cache_file;
+      }
+      else cache_init (buffer);
     }
     cache_loaded->insert (buffer);
   }
 }
 
+void
+cache_delete (string buffer) {
+  remove (get_tm_cache_path () * url_wildcard (buffer * "*"));
+}
+
 void
 cache_memorize () {
   cache_save ("font_cache.scm");
@@ -204,11 +404,87 @@ cache_refresh () {
   cache_data   = hashmap<tree, tree> ("?");
   cache_loaded = hashset<string> ();
   cache_changed= hashset<string> ();
+  cache_dirty  = hashset<string> ();
   cache_load ("font_cache.scm");
   cache_load ("font_basename.scm");
   cache_load ("validate_cache.scm");
 }
 
+/******************************************************************************
+ * Directories of cached files
+ ******************************************************************************/
+
+static hashset<string> cache_directory_evicted;
+
+static void
+cache_directory_evict (url dir, int max_bytes) {
+  // Remove the least recently written files until the directory fits
+  bool          error= false;
+  array<string> names= read_directory (dir, error);
+  if (error) return;
+  array<string>        order;
+  hashmap<string, int> sizes (0);
+  long                 total= 0;
+  for (int i= 0; i < N (names); i++) {
+    url u= dir * names[i];
+    if (names[i] == "." || names[i] == ".." || is_directory (u)) continue;
+    int sz= file_size (u);
+    if (sz < 0) continue;
+    string stamp= as_string (last_modified (u, false));
+    while (N (stamp) < 12)
+      stamp= "0" * stamp;
+    order << (stamp * "\t" * names[i]);
+    sizes (names[i])= sz;
+    total+= sz;
+  }
+  if (total <= max_bytes) return;
+  merge_sort (order);
+  for (int i= 0; i < N (order) && total > max_bytes; i++) {
+    int    pos = search_forwards ("\t", order[i]);
+    string name= order[i] (pos + 1, N (order[i]));
+    remove (dir * name);
+    total-= sizes[name];
+  }
+}
+
+url
+cache_directory (string name, int max_bytes) {
+  // The directory is cleaned up the first time it is used in a session
+  url dir= url ("$TEXMACS_HOME_PATH/system/cache") * url (name);
+  if (!exists (dir)) {
+    url parent= head (dir);
+    if (!exists (parent)) mkdir (parent);
+    mkdir (dir);
+  }
+  if (!cache_directory_evicted->contains (name)) {
+    cache_directory_evicted->insert (name);
+    cache_directory_evict (dir, max_bytes);
+  }
+  return dir;
+}
+
+void
+cache_hash (unsigned long long& h, string s) {
+  // FNV-1a, starting from CACHE_HASH_SEED
+  for (int i= 0; i < N (s); i++) {
+    h^= (unsigned char) s[i];
+    h*= 1099511628211ULL;
+  }
+}
+
+string
+cache_hexdigest (unsigned long long h) {
+  static const char* digits= "0123456789abcdef";
+  string             r (16);
+  for (int i= 15; i >= 0; i--, h>>= 4)
+    r[i]= digits[h & 15];
+  return r;
+}
+
+/******************************************************************************
+ * Initialization
+ ******************************************************************************/
+
 void
 cache_initialize () {
   texmacs_path= url_system ("$TEXMACS_PATH");
@@ -29,8 +29,16 @@ bool do_cache_stat (string name);
 
 void cache_save (string buffer);
 void cache_load (string buffer);
+void cache_delete (string buffer);
 void cache_memorize ();
 void cache_refresh ();
 void cache_initialize ();
 
+/*** Directories of cached files, stored under a hash of their sources ***/
+#define CACHE_HASH_SEED 14695981039346656037ULL
+
+url    cache_directory (string name, int max_bytes);
+void   cache_hash (unsigned long long& h, string s);
+string cache_hexdigest (unsigned long long h);
+
 #endif // defined DATA_CACHE_H
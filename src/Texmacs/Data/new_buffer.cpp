@@ -20,6 +20,7 @@
 #include "tm_link.hpp"
 #include "tmfs_url.hpp"
 #include "tree_observer.hpp"
+#include "tree_share.hpp"
 #include "web_files.hpp"
 
 using namespace moebius;
@@ -27,6 +28,7 @@ using namespace moebius;
 array<tm_buffer> bufs;
 
 string propose_title (string old_title, url u, tree doc);
+void   reset_inclusion (url name);
 
 /******************************************************************************
  * Check for changes in the buffer
@@ -450,10 +452,70 @@ import_loaded_tree (string s, url u, string fm) {
   return attach_subformat (t, u, fm);
 }
 
+/******************************************************************************
+ * Large verbatim files are opened through the line index: only a window
+ * of VERBATIM_WINDOW lines is loaded at a time, and the buffer is read-only
+ * since saving the window would truncate the file
+ ******************************************************************************/
+
+#define VERBATIM_HUGE (16 << 20) // files opened through the line index
+#define VERBATIM_WINDOW 50000    // number of lines loaded from such files
+
+static hashmap<string, int> verbatim_window_start (-1);
+static hashmap<string, url> verbatim_window_source (url_none ());
+
+static bool
+is_huge_verbatim (url u, string fm) {
+  if (fm == "generic" && (suffix (u) == "txt" || suffix (u) == "log"))
+    fm= "verbatim";
+  if (fm != "verbatim" && !prog_lang_exists (fm)) return false;
+  if (file_size (u) <= VERBATIM_HUGE) return false;
+  return verbatim_file_nr_lines (u) > VERBATIM_WINDOW;
+}
+
+static tree
+verbatim_window (url u, int start) {
+  tree body= verbatim_file_lines (u, start, start + VERBATIM_WINDOW);
+  return verbatim_body_to_document (body);
+}
+
+static void
+set_verbatim_window (url name, url u, int start, string fm) {
+  int n= verbatim_file_nr_lines (u);
+  start= max (0, min (start, n - VERBATIM_WINDOW));
+  set_buffer_tree (name, attach_subformat (verbatim_window (u, start), u, fm));
+  tm_buffer buf      = concrete_buffer (name);
+  buf->buf->read_only= true;
+  verbatim_window_start (as_string (name)) = start;
+  verbatim_window_source (as_string (name))= u;
+  int end= min (start + VERBATIM_WINDOW, n);
+  set_title_buffer (name, as_string (tail (name)) * " [lines " *
+                              as_string (start + 1) * "-" * as_string (end) *
+                              "/" * as_string (n) * "]");
+}
+
+int
+buffer_verbatim_window (url name) {
+  return verbatim_window_start[as_string (name)];
+}
+
+bool
+buffer_verbatim_page (url name, int delta) {
+  string name_s= as_string (name);
+  if (!verbatim_window_start->contains (name_s)) return true;
+  int start= verbatim_window_start[name_s] + delta * VERBATIM_WINDOW;
+  url u    = verbatim_window_source[name_s];
+  if (start < 0 || start >= verbatim_file_nr_lines (u)) return true;
+  set_verbatim_window (name, u, start, file_format (name));
+  return false;
+}
+
 tree
 import_tree (url u, string fm) {
   u= resolve (u, "fr");
   set_file_focus (u);
+  if (!is_none (u) && is_huge_verbatim (u, fm))
+    return attach_subformat (verbatim_window (u, 0), u, fm);
   string s;
   if (is_none (u) || tm_load_string (u, s, false)) return "error";
   return import_loaded_tree (s, u, fm);
@@ -461,6 +523,14 @@ import_tree (url u, string fm) {
 
 bool
 buffer_import (url name, url src, string fm) {
+  url u= resolve (src, "fr");
+  verbatim_window_start->reset (as_string (name));
+  verbatim_window_source->reset (as_string (name));
+  if (!is_none (u) && is_huge_verbatim (u, fm)) {
+    set_file_focus (u);
+    set_verbatim_window (name, u, 0, fm);
+    return false;
+  }
   tree t= import_tree (src, fm);
   if (t == "error") return true;
   set_buffer_tree (name, t);
@@ -485,7 +555,7 @@ load_style_tree (string package) {
   name= resolve (name);
   string doc_s;
   if (!load_string (name, doc_s, false)) {
-    tree doc= texmacs_document_to_tree (doc_s);
+    tree doc= texmacs_document_to_tree (doc_s, true);
     if (is_compound (doc)) doc= extract (doc, "body");
     style_tree_cache (package)= doc;
     return doc;
@@ -586,10 +656,16 @@ latex_expand (tree doc) {
 
 bool
 buffer_save (url name) {
+  if (buffer_verbatim_window (name) >= 0) {
+    std_warning << "Only part of " << name << " is loaded; "
+                << "it cannot be saved\n";
+    return true;
+  }
   string fm= file_format (name);
   if (fm == "generic") fm= "verbatim";
   bool r= buffer_export (name, name, fm);
   if (!r) {
+    reset_inclusion (name);
     pretend_buffer_saved (name);
     array<url> ws= buffer_to_windows (name);
     for (int i= 0; i < N (ws); i++)
@@ -603,25 +679,50 @@ buffer_save (url name) {
  ******************************************************************************/
 
 static hashmap<string, tree> document_inclusions ("");
+static hashmap<string, int>  inclusion_modified (0);
+static hashmap<string, int>  inclusion_hash (0);
 
 void
 reset_inclusions () {
   document_inclusions= hashmap<string, tree> ("");
+  inclusion_modified = hashmap<string, int> (0);
+  inclusion_hash     = hashmap<string, int> (0);
 }
 
 void
 reset_inclusion (url name) {
   string name_s= as_string (name);
   document_inclusions->reset (name_s);
+  inclusion_modified->reset (name_s);
+  inclusion_hash->reset (name_s);
 }
 
 tree
 load_inclusion (url name) {
   // url name= relative (base_file_name, file_name);
+  // Inclusions are shared between all buffers; they remain valid as long
+  // as the modification time or otherwise the contents are unchanged.
+  // They are only typeset and never edited, so their identical subtrees
+  // can be stored once for the whole session.
   string name_s= as_string (name);
-  if (document_inclusions->contains (name_s))
+  int    l     = last_modified (name, false);
+  if (document_inclusions->contains (name_s) && inclusion_modified[name_s] == l)
+    return document_inclusions[name_s];
+  url    u= resolve (name, "fr");
+  string s;
+  if (is_none (u) || tm_load_string (u, s, false))
+    return extract_document (tree ("error"));
+  int h= hash (s);
+  if (document_inclusions->contains (name_s) && inclusion_hash[name_s] == h) {
+    inclusion_modified (name_s)= l;
     return document_inclusions[name_s];
-  tree doc= extract_document (import_tree (name, "generic"));
-  if (!is_func (doc, ERROR)) document_inclusions (name_s)= doc;
+  }
+  tree doc= extract_document (import_loaded_tree (s, u, "generic"));
+  if (!is_func (doc, ERROR)) {
+    doc                         = share_subtrees (doc);
+    document_inclusions (name_s)= doc;
+    inclusion_modified (name_s) = l;
+    inclusion_hash (name_s)     = h;
+  }
   return doc;
 }
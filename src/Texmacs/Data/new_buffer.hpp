@@ -109,6 +109,8 @@ bool       buffer_import (url name, url src, string fm);
 bool       buffer_load (url name);
 bool       buffer_export (url name, url dest, string fm);
 bool       buffer_save (url name);
+int        buffer_verbatim_window (url name);
+bool       buffer_verbatim_page (url name, int delta);
 tree       import_loaded_tree (string s, url u, string fm);
 tree       import_tree (url u, string fm);
 bool       export_tree (tree doc, url u, string fm);
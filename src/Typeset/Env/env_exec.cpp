@@ -1223,7 +1223,7 @@ edit_env_rep::exec_use_package (tree t) {
     // cout << as_string (t[i]) << " -> " << name << "\n";
     string doc_s;
     if (!load_string (name, doc_s, false)) {
-      tree doc= texmacs_document_to_tree (doc_s);
+      tree doc= texmacs_document_to_tree (doc_s, true);
       if (is_compound (doc)) exec (filter_style (extract (doc, "body")));
     }
   }
@@ -13,6 +13,7 @@
 #ifndef BOXES_H
 #define BOXES_H
 
+#include "alloc_stats.hpp"
 #include "basic.hpp"
 #include "font.hpp"
 #include "frame.hpp"
@@ -278,8 +279,12 @@ inline box_rep::box_rep (path ip2)
     : x0 (0), y0 (0), x1 (0), y1 (0), x2 (0), y2 (0), x3 (0), y3 (0), x4 (0),
       y4 (0), ip (ip2) {
   TM_DEBUG (box_count++);
+  alloc_hook_new (ALLOC_BOX);
+}
+inline box_rep::~box_rep () {
+  TM_DEBUG (box_count--);
+  alloc_hook_delete (ALLOC_BOX);
 }
-inline box_rep::~box_rep () { TM_DEBUG (box_count--); }
 inline bool
 box_rep::test_in (SI x, SI y) {
   return (x >= x1) && (x < x2) && (y >= y1) && (y < y2);
@@ -0,0 +1,89 @@
+
+/******************************************************************************
+ * MODULE     : indexation_test.cpp
+ * DESCRIPTION: tests on the persistent index of document collections
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "base.hpp"
+#include "convert.hpp"
+#include "file.hpp"
+#include "sys_utils.hpp"
+#include "tree_helper.hpp"
+#include <moebius/data/scheme.hpp>
+
+using moebius::data::scm_unquote;
+
+static url index_home, index_docs;
+
+static string
+search_files (string query) {
+  scheme_tree r= index_search (query);
+  string      s;
+  for (int i= 0; i < N (r); i++)
+    s << as_string (tail (url_system (scm_unquote (r[i][0]->label)))) << " ";
+  return s;
+}
+
+class TestIndexation : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase ();
+  void test_search ();
+  void test_incremental_update ();
+  void test_automatic_update ();
+};
+
+void
+TestIndexation::initTestCase () {
+  init_lolly ();
+  index_home= url_temp ("_index_home");
+  mkdir (index_home);
+  set_env ("TEXMACS_HOME_PATH", as_string (index_home));
+  index_docs= index_home * "docs";
+  mkdir (index_docs);
+  mkdir (index_docs * "sub");
+  save_string (index_docs * "a.txt", "apple banana apple");
+  save_string (index_docs * "sub/b.txt", "apple cherry");
+  save_string (index_docs * "c.png", "apple");
+  index_update (index_docs);
+}
+
+void
+TestIndexation::test_search () {
+  qcompare (search_files ("apple"), "a.txt b.txt ");
+  qcompare (search_files ("Apple cherry"), "b.txt ");
+  qcompare (search_files ("durian"), "");
+  QVERIFY (exists (index_home * "system/cache/document_index.scm"));
+}
+
+void
+TestIndexation::test_incremental_update () {
+  save_string (index_docs * "sub/b.txt", "durian durian durian cherry");
+  remove (index_docs * "a.txt");
+  index_update (index_docs);
+  qcompare (search_files ("apple"), "");
+  qcompare (search_files ("durian"), "b.txt ");
+}
+
+void
+TestIndexation::test_automatic_update () {
+  // searches rescan the indexed directories for modified files
+  save_string (index_docs * "sub/e.txt", "elderberry");
+  qcompare (search_files ("elderberry"), "e.txt ");
+  save_string (index_docs * "sub/e.txt", "fig and more figs");
+  qcompare (search_files ("elderberry"), "");
+  qcompare (search_files ("fig"), "e.txt ");
+  remove (index_docs * "sub/e.txt");
+  qcompare (search_files ("fig"), "");
+}
+
+QTEST_MAIN (TestIndexation)
+#include "indexation_test.moc"
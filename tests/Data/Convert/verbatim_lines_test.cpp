@@ -0,0 +1,101 @@
+/******************************************************************************
+ * MODULE     : verbatim_lines_test.cpp
+ * DESCRIPTION: tests on the line indexed access to verbatim files
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "Verbatim/verbatim_lines.hpp"
+#include "base.hpp"
+#include "convert.hpp"
+#include "file.hpp"
+#include "sys_utils.hpp"
+#include "tree_helper.hpp"
+
+static url lines_dir;
+
+// The body of the document as obtained by converting the whole file
+static tree
+whole_body (string s) {
+  tree body= extract (verbatim_document_to_tree (s, false, "auto"), "body");
+  if (!is_func (body, DOCUMENT)) body= tree (DOCUMENT, body);
+  return body;
+}
+
+class TestVerbatimLines : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase ();
+  void test_line_endings ();
+  void test_charset ();
+  void test_mapped_file ();
+  void test_shrinking_file ();
+};
+
+void
+TestVerbatimLines::initTestCase () {
+  init_lolly ();
+  lines_dir= url_temp ("_verbatim_lines");
+  mkdir (lines_dir);
+}
+
+void
+TestVerbatimLines::test_line_endings () {
+  string s= "first\nsecond\r\nthird\rfourth\n\nlast";
+  url    u= lines_dir * "endings.txt";
+  save_string (u, s);
+  QCOMPARE (verbatim_file_nr_lines (u), 6);
+  QVERIFY (verbatim_file_lines (u, 0, 6) == whole_body (s));
+  QVERIFY (verbatim_file_lines (u, 2, 3) == tree (DOCUMENT, "third"));
+}
+
+void
+TestVerbatimLines::test_charset () {
+  // the charset is detected on the whole file, not line by line
+  string latin= "plain\ncaf\xe9\nend";
+  url    u    = lines_dir * "latin.txt";
+  save_string (u, latin);
+  QVERIFY (verbatim_file_lines (u, 0, 3) == whole_body (latin));
+  QVERIFY (verbatim_file_lines (u, 0, 1) == tree (DOCUMENT, "plain"));
+
+  string utf8= "\xef\xbb\xbfna\xc3\xafve\nsecond";
+  url    v   = lines_dir * "utf8.txt";
+  save_string (v, utf8);
+  QVERIFY (verbatim_file_lines (v, 0, 2) == whole_body (utf8));
+}
+
+void
+TestVerbatimLines::test_mapped_file () {
+  // freshly written files, like logs which are still growing, are mapped
+  url u= lines_dir * "mapped.txt";
+  save_string (u, "alpha\nbeta\n");
+  verbatim_lines vl= get_verbatim_lines (u);
+#if !defined(OS_WIN) && !defined(OS_WASM)
+  QVERIFY (vl->mapped != NULL);
+#endif
+  QCOMPARE (vl->nr_lines (), 3);
+  QVERIFY (vl->lines (0, 3) == tree (DOCUMENT, "alpha", "beta", ""));
+}
+
+void
+TestVerbatimLines::test_shrinking_file () {
+  url u= lines_dir * "log.txt";
+  save_string (u, "one\ntwo\nthree\nfour\n");
+  verbatim_lines vl= get_verbatim_lines (u);
+  QCOMPARE (vl->nr_lines (), 5);
+  save_string (u, "one\ntwo\n");
+  // an index which is still in use switches to a copy of the new contents
+  QVERIFY (vl->lines (0, 5) == tree (DOCUMENT, "one", "two", ""));
+  QVERIFY (vl->mapped == NULL);
+  QCOMPARE (verbatim_file_nr_lines (u), 3);
+  QVERIFY (verbatim_file_lines (u, 0, 5) == tree (DOCUMENT, "one", "two", ""));
+}
+
+QTEST_MAIN (TestVerbatimLines)
+#include "verbatim_lines_test.moc"
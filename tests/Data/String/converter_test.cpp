@@ -13,6 +13,123 @@
 #include "base.hpp"
 #include "converter.hpp"
 #include "file.hpp"
+#include "simd_ascii.hpp"
+
+#include <lolly/data/numeral.hpp>
+#include <lolly/data/unicode.hpp>
+
+using lolly::data::decode_from_utf8;
+using lolly::data::encode_as_utf8;
+using lolly::data::from_hex;
+using lolly::data::to_Hex;
+
+/******************************************************************************
+ * Reference versions without the fast paths for ascii runs
+ ******************************************************************************/
+
+static string
+hashtree_apply (hashtree<char, string> ht, string s) {
+  string r;
+  int    i= 0;
+  while (i < N (s)) {
+    int                    last= -1;
+    string                 value;
+    hashtree<char, string> node= ht;
+    for (int j= i; j < N (s) && node->contains (s[j]); j++) {
+      node= node (s[j]);
+      if (node->label != "") {
+        last = j;
+        value= node->label;
+      }
+    }
+    if (last < 0) r << s[i++];
+    else {
+      r << value;
+      i= last + 1;
+    }
+  }
+  return r;
+}
+
+// The converters only keep their compiled automata, so the references
+// rebuild the dictionaries as in converter_rep::load
+static hashtree<char, string>
+utf8_to_cork_dictionary () {
+  hashtree<char, string> dic;
+  hashtree_from_dictionary (dic, "corktounicode", UTF8, BIT2BIT, true);
+  hashtree_from_dictionary (dic, "unicode-cork-oneway", UTF8, BIT2BIT, false);
+  hashtree_from_dictionary (dic, "tmuniversaltounicode", UTF8, BIT2BIT, true);
+  hashtree_from_dictionary (dic, "unicode-symbol-oneway", UTF8, BIT2BIT, true);
+  return dic;
+}
+
+static hashtree<char, string>
+cork_to_utf8_dictionary () {
+  hashtree<char, string> dic;
+  hashtree_from_dictionary (dic, "corktounicode", BIT2BIT, UTF8, false);
+  hashtree_from_dictionary (dic, "cork-unicode-oneway", BIT2BIT, UTF8, false);
+  hashtree_from_dictionary (dic, "tmuniversaltounicode", BIT2BIT, UTF8, false);
+  hashtree_from_dictionary (dic, "symbol-unicode-oneway", BIT2BIT, UTF8, false);
+  hashtree_from_dictionary (dic, "symbol-unicode-fallback", BIT2BIT, UTF8,
+                            false);
+  hashtree_from_dictionary (dic, "symbol-unicode-math", BIT2BIT, UTF8, false);
+  return dic;
+}
+
+static string
+scalar_utf8_to_cork (string input) {
+  hashtree<char, string> dic= utf8_to_cork_dictionary ();
+  int                    start, i, n= N (input);
+  string    output;
+  for (i= 0; i < n;) {
+    start            = i;
+    unsigned int code= decode_from_utf8 (input, i);
+    string       s   = input (start, i);
+    string       r   = hashtree_apply (dic, s);
+    if (r == s && code >= 256) r= "<#" * to_Hex (code) * ">";
+    output << r;
+  }
+  return output;
+}
+
+static string
+scalar_cork_to_utf8 (string input) {
+  hashtree<char, string> dic  = cork_to_utf8_dictionary ();
+  int                    start= 0, i, n= N (input);
+  string                 r;
+  for (i= 0; i < n; i++)
+    if (input[i] == '<' && i + 1 < n && input[i + 1] == '#') {
+      r << hashtree_apply (dic, input (start, i));
+      start= i= i + 2;
+      while (i < n && input[i] != '>')
+        i++;
+      r << encode_as_utf8 (from_hex (input (start, i)));
+      start= i + 1;
+    }
+  r << hashtree_apply (dic, input (start, n));
+  return r;
+}
+
+static array<string>
+sample_strings () {
+  array<string> a;
+  a << string ("") << string ("plain ascii text");
+  a << string ("quotes `like' ``this'' and \\backslash\\ <less> {x}");
+  a << string ("中文 mixed with ascii, “quoted” and ‘single’ text");
+  a << string ("Ærø, façade, naïve, Straße — dash – dash … ellipsis");
+  a << string ("<#4E2D><alpha>+<beta>=<gamma> and <#1F600> emoji");
+  string longer;
+  for (int i= 0; i < 10; i++)
+    longer << "A fairly long run of ascii characters, long enough for "
+           << "vector loads: 0123456789abcdefghijklmnopqrstuvwxyz"
+           << (i % 3 == 0 ? "é" : (i % 3 == 1 ? "<" : "\t"));
+  a << longer;
+  string chunks;
+  for (int i= 0; i < 300; i++)
+    chunks << (i % 97 == 96 ? '\'' : (char) ('a' + (i % 26)));
+  a << chunks;
+  return a;
+}
 
 class TestConverter : public QObject {
   Q_OBJECT
@@ -20,6 +137,10 @@ class TestConverter : public QObject {
 private slots:
   void init () { init_lolly (); };
   void test_utf8_to_cork ();
+  void test_ascii_prefix ();
+  void test_utf8_to_cork_runs ();
+  void test_cork_to_utf8_runs ();
+  void test_flat_dfa ();
 };
 
 void
@@ -29,5 +150,49 @@ TestConverter::test_utf8_to_cork () {
   qcompare (utf8_to_cork ("”"), "\x11");
 }
 
+void
+TestConverter::test_ascii_prefix () {
+  for (int n= 0; n < 80; n++)
+    for (int pos= 0; pos <= n; pos++) {
+      string s (n);
+      for (int i= 0; i < n; i++)
+        s[i]= 'a' + (i % 26);
+      if (pos < n) s[pos]= (char) 0xC3;
+      QCOMPARE (ascii_prefix (&s[0], n), scalar_ascii_prefix (&s[0], n));
+      if (pos < n) s[pos]= '\n';
+      QCOMPARE (printable_ascii_prefix (&s[0], n),
+                scalar_printable_ascii_prefix (&s[0], n));
+    }
+}
+
+void
+TestConverter::test_utf8_to_cork_runs () {
+  array<string> a= sample_strings ();
+  for (int i= 0; i < N (a); i++)
+    qcompare (utf8_to_cork (a[i]), scalar_utf8_to_cork (a[i]));
+}
+
+void
+TestConverter::test_cork_to_utf8_runs () {
+  array<string> a= sample_strings ();
+  for (int i= 0; i < N (a); i++) {
+    string cork= scalar_utf8_to_cork (a[i]);
+    qcompare (cork_to_utf8 (cork), scalar_cork_to_utf8 (cork));
+  }
+}
+
+void
+TestConverter::test_flat_dfa () {
+  hashtree<char, string> dic;
+  hashtree_from_dictionary (dic, "HTMLlat1", CHAR_ENTITY, ENTITY_NAME, true);
+  hashtree_from_dictionary (dic, "HTMLspecial", CHAR_ENTITY, ENTITY_NAME, true);
+  hashtree_from_dictionary (dic, "HTMLsymbol", CHAR_ENTITY, ENTITY_NAME, true);
+  converter     conv= load_converter ("UTF-8", "HTML");
+  array<string> a   = sample_strings ();
+  a << string ("<a href=\"x\">&amp;</a>") << string ("é ü © ∀x ∈ ℝ");
+  for (int i= 0; i < N (a); i++)
+    qcompare (apply (conv, a[i]), hashtree_apply (dic, a[i]));
+}
+
 QTEST_MAIN (TestConverter)
 #include "converter_test.moc"
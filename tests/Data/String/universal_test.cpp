@@ -0,0 +1,105 @@
+
+/******************************************************************************
+ * MODULE     : universal_test.cpp
+ * DESCRIPTION: tests on case changes and accents of universal strings
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "base.hpp"
+#include "universal.hpp"
+
+/******************************************************************************
+ * Reference versions working character by character
+ ******************************************************************************/
+
+static string
+scalar_change_case (string s, string (*change_char) (string)) {
+  string r;
+  int    i= 0, n= N (s);
+  while (i < n) {
+    int start= i;
+    tm_char_forwards (s, i);
+    r << change_char (s (start, i));
+  }
+  return r;
+}
+
+static string
+scalar_unaccent_all (string s) {
+  string r;
+  int    i= 0, n= N (s);
+  while (i < n) {
+    int start= i;
+    tm_char_forwards (s, i);
+    string c= s (start, i);
+    string u= uni_unaccent_char (c);
+    r << (u == "" ? c : u);
+  }
+  return r;
+}
+
+static array<string>
+sample_strings () {
+  array<string> a;
+  a << string ("") << string ("Plain ASCII text, 123!");
+  a << string ("\xC9t\xE9 \xC0 la fa\xE7" "ade, na\xEFve, \x9F\xFF");
+  a << string ("<#4E2D><#4e2d><#0041><#100><#17F><#3A3><#3c3><#416><#44F>");
+  a << string ("<alpha><Beta><vartheta><Omega> and <#> <#zz> <#41");
+  return a;
+}
+
+class TestUniversal : public QObject {
+  Q_OBJECT
+
+private slots:
+  void init () { init_lolly (); }
+  void test_case_char ();
+  void test_case_all ();
+  void test_unaccent_all ();
+  void test_translit ();
+};
+
+void
+TestUniversal::test_case_char () {
+  qcompare (uni_locase_char ("A"), "a");
+  qcompare (uni_upcase_char ("\xE9"), "\xC9");
+  qcompare (uni_locase_char ("<#100>"), "<#101>");
+  qcompare (uni_upcase_char ("<#3c3>"), "<#3A3>");
+  qcompare (uni_locase_char ("<#4e2d>"), "<#4E2D>");
+  qcompare (uni_upcase_char ("<alpha>"), "<Alpha>");
+}
+
+void
+TestUniversal::test_case_all () {
+  array<string> a= sample_strings ();
+  for (int i= 0; i < N (a); i++) {
+    qcompare (uni_locase_all (a[i]),
+              scalar_change_case (a[i], uni_locase_char));
+    qcompare (uni_upcase_all (a[i]),
+              scalar_change_case (a[i], uni_upcase_char));
+  }
+  qcompare (uni_Locase_all ("<#416>OK"), "<#416>ok");
+}
+
+void
+TestUniversal::test_unaccent_all () {
+  array<string> a= sample_strings ();
+  for (int i= 0; i < N (a); i++)
+    qcompare (uni_unaccent_all (a[i]), scalar_unaccent_all (a[i]));
+  QVERIFY (uni_before ("\xC9t\xE9", "etz"));
+}
+
+void
+TestUniversal::test_translit () {
+  qcompare (uni_translit ("<#416><#44f><#0416>"), "ZHia<#0416>");
+  qcompare (uni_translit ("\xE9t\xE9 <#42A>x"), "ete x");
+}
+
+QTEST_MAIN (TestUniversal)
+#include "universal_test.moc"
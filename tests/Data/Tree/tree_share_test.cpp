@@ -0,0 +1,105 @@
+
+/******************************************************************************
+ * MODULE     : tree_share_test.cpp
+ * DESCRIPTION: tests on the sharing of identical subtrees
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "base.hpp"
+#include "convert.hpp"
+#include "fast_alloc.hpp"
+#include "file.hpp"
+#include "hashset.hpp"
+#include "tree_helper.hpp"
+#include "tree_share.hpp"
+
+// number of tree nodes which are actually allocated
+static int
+count_nodes (tree t, hashset<pointer>& done) {
+  pointer p= (pointer) t.operator->();
+  if (done->contains (p)) return 0;
+  done->insert (p);
+  int r= 1;
+  if (is_compound (t))
+    for (int i= 0; i < N (t); i++)
+      r+= count_nodes (t[i], done);
+  return r;
+}
+
+static int
+count_nodes (tree t) {
+  hashset<pointer> done;
+  return count_nodes (t, done);
+}
+
+// number of bytes held by a freshly loaded document
+static int
+document_bytes (string s, bool share) {
+  int  before= mem_used ();
+  tree t     = texmacs_document_to_tree (s, share);
+  return mem_used () - before;
+}
+
+class TestTreeShare : public QObject {
+  Q_OBJECT
+
+private slots:
+  void init () { init_lolly (); }
+  void test_share_subtrees ();
+  void test_share_documents ();
+  void test_share_memory ();
+};
+
+void
+TestTreeShare::test_share_subtrees () {
+  tree big (DOCUMENT);
+  for (int i= 0; i < 10; i++)
+    big << compound ("strong", "x");
+  tree t (DOCUMENT);
+  t << compound ("strong", "x") << compound ("strong", "x") << tree ("x")
+    << big << copy (big);
+  tree u= share_subtrees (copy (t));
+  QVERIFY (u == t);
+  QVERIFY (strong_equal (u[0], u[1]));
+  QVERIFY (strong_equal (u[0][0], u[2]));
+  QVERIFY (!strong_equal (u[3], u[4]));
+  QCOMPARE (count_nodes (u), 5);
+  QCOMPARE (count_nodes (share_subtrees (copy (t), 0)), count_nodes (t));
+}
+
+void
+TestTreeShare::test_share_documents () {
+  url         tm_base ("$TEXMACS_PATH/tests/tm/");
+  const char* names[]= {"11_15.tm", "29_1_1.tm", "64_1.tm"};
+  for (int i= 0; i < 3; i++) {
+    string s;
+    QVERIFY (!load_string (tm_base * names[i], s, false));
+    tree t= texmacs_document_to_tree (s);
+    tree u= texmacs_document_to_tree (s, true);
+    QVERIFY (u == t);
+    QVERIFY (count_nodes (u) < count_nodes (t));
+  }
+}
+
+void
+TestTreeShare::test_share_memory () {
+  url         tm_base ("$TEXMACS_PATH/tests/tm/");
+  const char* names[]= {"11_15.tm", "29_1_1.tm", "64_1.tm"};
+  for (int i= 0; i < 3; i++) {
+    string s;
+    QVERIFY (!load_string (tm_base * names[i], s, false));
+    int plain = document_bytes (s, false);
+    int shared= document_bytes (s, true);
+    QVERIFY (shared > 0);
+    QVERIFY (shared < plain);
+  }
+}
+
+QTEST_MAIN (TestTreeShare)
+#include "tree_share_test.moc"
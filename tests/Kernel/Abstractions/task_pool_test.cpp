@@ -0,0 +1,172 @@
+
+/******************************************************************************
+ * MODULE     : task_pool_test.cpp
+ * DESCRIPTION: tests on the work-stealing pool of threads
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "task_pool.hpp"
+
+#include <stdexcept>
+
+static int
+parallel_fib (task_pool& pool, int n) {
+  if (n < 2) return n;
+  task_future<int> a= pool.spawn ([&pool, n] () {
+    return parallel_fib (pool, n - 1);
+  });
+  int b= parallel_fib (pool, n - 2);
+  return a.get () + b;
+}
+
+// A task which keeps the only worker of a pool busy until it is released
+static task_future<int>
+occupy (task_pool& pool, std::atomic<bool>& started,
+        std::atomic<bool>& released) {
+  task_future<int> r= pool.spawn ([&started, &released] () {
+    started= true;
+    while (!released)
+      std::this_thread::yield ();
+    return 1;
+  });
+  while (!started)
+    std::this_thread::yield ();
+  return r;
+}
+
+class TestTaskPool : public QObject {
+  Q_OBJECT
+
+private slots:
+  void test_spawn ();
+  void test_nested ();
+  void test_cancel ();
+  void test_exception ();
+  void test_continuation ();
+  void test_void ();
+};
+
+void
+TestTaskPool::test_spawn () {
+  task_pool                     pool (4);
+  std::vector<task_future<int>> futures;
+  for (int i= 0; i < 100; i++)
+    futures.push_back (pool.spawn ([i] () { return i * i; }));
+  int sum= 0;
+  for (int i= 0; i < 100; i++)
+    sum+= futures[i].get ();
+  QCOMPARE (sum, 328350);
+  QCOMPARE (pool.size (), 4);
+}
+
+void
+TestTaskPool::test_nested () {
+  task_pool pool (3);
+  QCOMPARE (parallel_fib (pool, 18), 2584);
+  // a single worker must not deadlock on the tasks it waits for
+  task_pool solo (1);
+  QCOMPARE (parallel_fib (solo, 12), 144);
+}
+
+void
+TestTaskPool::test_cancel () {
+  task_pool         pool (1);
+  std::atomic<bool> started (false), released (false);
+  task_future<int>  busy  = occupy (pool, started, released);
+  task_future<int>  queued= pool.spawn ([] () { return 5; });
+  queued.cancel ();
+  QVERIFY (queued.is_ready ());
+  released= true;
+  QCOMPARE (busy.get (), 1);
+  QCOMPARE (queued.get (), 0);
+
+  std::atomic<bool> running (false);
+  task_future<int>  polling= pool.spawn ([&running] () {
+    running= true;
+    while (!task_cancelled ())
+      std::this_thread::yield ();
+    return 7;
+  });
+  while (!running)
+    std::this_thread::yield ();
+  polling.cancel ();
+  QCOMPARE (polling.get (), 7);
+  QVERIFY (polling.is_cancelled ());
+}
+
+void
+TestTaskPool::test_exception () {
+  task_pool        pool (2);
+  task_future<int> f= pool.spawn ([] () -> int {
+    throw std::runtime_error ("synthetic failure");
+  });
+  bool ok= false;
+  try {
+    f.get ();
+  } catch (std::runtime_error& e) {
+    ok= true;
+  }
+  QVERIFY (ok);
+}
+
+void
+TestTaskPool::test_continuation () {
+  task_pool        pool (2);
+  int              result= 0;
+  std::thread::id  where;
+  task_future<int> f= pool.spawn ([] () { return 42; });
+  f.then_on_main ([&result, &where] (int v) {
+    result= v;
+    where = std::this_thread::get_id ();
+  });
+  QTRY_COMPARE (result, 42);
+  QVERIFY (where == std::this_thread::get_id ());
+
+  int              skipped= 0;
+  task_future<int> g      = pool.spawn ([] () { return 1; });
+  g.get ();
+  g.then_on_main ([&skipped] (int v) { skipped= v; });
+  g.cancel ();
+  task_run_main ();
+  QCOMPARE (skipped, 0);
+}
+
+void
+TestTaskPool::test_void () {
+  task_pool                      pool (3);
+  std::atomic<int>               count (0);
+  std::vector<task_future<void>> futures;
+  for (int i= 0; i < 50; i++)
+    futures.push_back (pool.spawn ([&count, i] () { count+= i; }));
+  for (int i= 0; i < 50; i++)
+    futures[i].get ();
+  QCOMPARE ((int) count, 1225);
+
+  bool              done= false;
+  task_future<void> f   = pool.spawn ([&count] () { count= 0; });
+  f.get ();
+  f.then_on_main ([&done] () { done= true; });
+  task_run_main ();
+  QVERIFY (done);
+  QCOMPARE ((int) count, 0);
+
+  task_future<void> g= pool.spawn ([] () -> void {
+    throw std::runtime_error ("synthetic failure");
+  });
+  bool ok= false;
+  try {
+    g.get ();
+  } catch (std::runtime_error& e) {
+    ok= true;
+  }
+  QVERIFY (ok);
+}
+
+QTEST_MAIN (TestTaskPool)
+#include "task_pool_test.moc"
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * MODULE     : bibtex_functions_test.cpp
+ * DESCRIPTION: tests on the scanners of bibtex names and fields
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "Bibtex/bibtex_functions.hpp"
+#include "base.hpp"
+
+static string
+words_of (string s) {
+  // the words are stored from the last one to the first one
+  list<string> l= get_words (s);
+  string       r;
+  for (int i= 0; i < N (l); i++)
+    r << "|" << l[i];
+  return r;
+}
+
+static string
+ands_of (string s) {
+  // the positions after each "and", and at the end of the names
+  string r;
+  int    pos= 0;
+  while (pos < N (s)) {
+    bool found= search_and_keyword (s, pos);
+    r << (found ? "T" : "F") << as_string (pos) << " ";
+  }
+  return r;
+}
+
+class TestBibtexFunctions : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase () { init_lolly (); }
+  void test_bib_to_latex ();
+  void test_get_words ();
+  void test_get_until_char ();
+  void test_search_and_keyword ();
+};
+
+void
+TestBibtexFunctions::test_bib_to_latex () {
+  qcompare (bib_to_latex ("Plain text"), "{Plain text}");
+  qcompare (bib_to_latex ("50% off"), "{50\\% off}");
+  // escaped braces are kept and do not open groups
+  qcompare (bib_to_latex ("a \\{ b \\} c"), "{a \\{ b \\} c}");
+  // display math becomes inline math, math is kept as is
+  qcompare (bib_to_latex ("x $$y$$ z"), "{x $y$ z}");
+  qcompare (bib_to_latex ("$x^2$"), "{$x^2$}");
+  // brackets are protected
+  qcompare (bib_to_latex ("see [1] and [2]"), "{see {[}1{]} and {[}2{]}}");
+  qcompare (bib_to_latex ("{[x]}"), "{\\keepcase{{[}x{]}}}");
+  // braced groups keep their case up to the end of the word
+  qcompare (bib_to_latex ("A {B}ook"), "{A \\keepcase{Book}}");
+  qcompare (bib_to_latex ("The {LaTeX} {Comp}anion"),
+            "{The \\keepcase{LaTeX} \\keepcase{Companion}}");
+  qcompare (bib_to_latex ("a {B c} d"), "{a \\keepcase{B c} d}");
+  qcompare (bib_to_latex ("{{Nested}} group"),
+            "{\\keepcase{{Nested}} group}");
+  // special characters and commands are not keepcase groups
+  qcompare (bib_to_latex ("{\\'e}t{\\'e}"), "{{\\'e}t{\\'e}}");
+  qcompare (bib_to_latex ("{\\TeX} book"), "{{\\TeX} book}");
+  qcompare (bib_to_latex ("\\emph{Word} rest"), "{\\emph{Word} rest}");
+  qcompare (bib_to_latex ("end\\"), "{end\\}");
+}
+
+void
+TestBibtexFunctions::test_get_words () {
+  qcompare (words_of ("  Donald E.  Knuth "), "|Knuth|E.|Donald");
+  qcompare (words_of ("de la Fontaine"), "|Fontaine|la|de");
+  qcompare (words_of ("{van der} Berg"), "|Berg|{van der}");
+  qcompare (words_of ("a {b c} d"), "|d|{b c}|a");
+  qcompare (words_of ("\\'Erd\\H{o}s P\\'al"), "|P\\'al|\\'Erd\\H{o}s");
+  // math does not protect spaces
+  qcompare (words_of ("$x y$ z"), "|z|y$|$x");
+  qcompare (words_of (""), "");
+}
+
+void
+TestBibtexFunctions::test_get_until_char () {
+  int pos= 0;
+  qcompare (get_until_char ("Knuth, Donald E.", pos, ','), "Knuth");
+  QCOMPARE (pos, 6);
+  qcompare (get_until_char ("Knuth, Donald E.", pos, ','), " Donald E.");
+  QCOMPARE (pos, 16);
+  // separators in groups, in math or after a backslash are ignored
+  pos= 0;
+  qcompare (get_until_char ("{Smith, Jr}, John", pos, ','), "{Smith, Jr}");
+  QCOMPARE (pos, 12);
+  pos= 0;
+  qcompare (get_until_char ("$a,b$, c", pos, ','), "$a,b$");
+  QCOMPARE (pos, 6);
+  pos= 0;
+  qcompare (get_until_char ("\\{, x", pos, ','), "\\{");
+  QCOMPARE (pos, 3);
+  // the null character reads until the end
+  pos= 0;
+  qcompare (get_until_char ("a,b,c", pos, '\0'), "a,b,c");
+  QCOMPARE (pos, 5);
+}
+
+void
+TestBibtexFunctions::test_search_and_keyword () {
+  qcompare (ands_of ("Knuth and Lamport"), "T10 F17 ");
+  qcompare (ands_of ("Alpha  and  Beta and Gamma"), "T11 T21 F26 ");
+  qcompare (ands_of ("A and B"), "T6 F7 ");
+  // "and" must be a separate word at the top level
+  qcompare (ands_of ("{Barnes and Noble} and Smith"), "T23 F28 ");
+  qcompare (ands_of ("Sand and Sandy"), "T9 F14 ");
+  qcompare (ands_of ("andrew"), "F6 ");
+  qcompare (ands_of ("A and"), "F5 ");
+  // math does not hide it
+  qcompare (ands_of ("$x and y$ and C"), "T7 T14 F15 ");
+}
+
+QTEST_MAIN (TestBibtexFunctions)
+#include "bibtex_functions_test.moc"
@@ -0,0 +1,145 @@
+
+/******************************************************************************
+ * MODULE     : bibtex_test.cpp
+ * DESCRIPTION: tests on the cached generation of bibliographies
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "Bibtex/bibtex.hpp"
+#include "analyze.hpp"
+#include "base.hpp"
+#include "file.hpp"
+#include "sys_utils.hpp"
+#include "tree_helper.hpp"
+
+static url stub_home, stub_counter, stub_bib;
+
+static int
+stub_runs () {
+  string s;
+  if (load_string (stub_counter, s, false)) return 0;
+  return N (tokenize (s, "\n")) - 1;
+}
+
+class TestBibtex : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase ();
+  void cleanupTestCase () { set_bibtex_command ("bibtex"); }
+  void test_cache_key ();
+  void test_bst_key ();
+  void test_cached_bbl ();
+  void test_failed_run ();
+};
+
+void
+TestBibtex::initTestCase () {
+  init_lolly ();
+  stub_home= url_temp ("_bibtex_home");
+  mkdir (stub_home);
+  mkdir (stub_home * "system");
+  mkdir (stub_home * "system/bib");
+  set_env ("TEXMACS_HOME_PATH", as_string (stub_home));
+  stub_counter= stub_home * "runs.txt";
+  stub_bib    = stub_home * "refs.bib";
+  save_string (stub_bib, "@book{a, title={A}}\n@book{b, title={B}}\n");
+  // the stub writes a fixed bibliography and a warning, and records each
+  // of its runs; it fails for the style "broken", after writing the output
+  url stub= stub_home * "stub.sh";
+  save_string (stub, "echo run >> '" * as_string (stub_counter) *
+                         "'\necho 'Warning--stub warning'\n"
+                         "printf '\\\\begin{thebibliography}{1}\\n"
+                         "\\\\end{thebibliography}\\n' > temp.bbl\n"
+                         "grep -q 'bibstyle{broken}' temp.aux && exit 1\n"
+                         "exit 0\n");
+  set_bibtex_command ("sh '" * as_string (stub) * "'");
+}
+
+void
+TestBibtex::test_cache_key () {
+  string k1= bibtex_cache_key ("plain", stub_bib, tuple ("a", "b"));
+  string k2= bibtex_cache_key ("plain", stub_bib, tuple ("b", "a"));
+  string k3= bibtex_cache_key ("alpha", stub_bib, tuple ("a", "b"));
+  QCOMPARE (N (k1), 16);
+  QVERIFY (k1 == bibtex_cache_key ("plain", stub_bib, tuple ("a", "b")));
+  QVERIFY (k1 != k2);
+  QVERIFY (k1 != k3);
+  QVERIFY (bibtex_cache_key ("plain", stub_home * "none.bib", tuple ()) == "");
+}
+
+void
+TestBibtex::test_bst_key () {
+  // local and $BSTINPUTS styles are part of the key, the working
+  // directory of bibtex being searched first
+  tree   cites= tuple ("a");
+  string k0   = bibtex_cache_key ("local", stub_bib, cites);
+  url    dir  = stub_home * "bst";
+  mkdir (dir);
+  set_env ("BSTINPUTS", as_string (dir));
+  save_string (dir * "local.bst", "ENTRY {} {} {}\n");
+  string k1= bibtex_cache_key ("local", stub_bib, cites);
+  QVERIFY (k1 != k0);
+  save_string (dir * "local.bst", "ENTRY {title} {} {}\n");
+  string k2= bibtex_cache_key ("local", stub_bib, cites);
+  QVERIFY (k2 != k1);
+  url work ("$TEXMACS_HOME_PATH/system/bib/local.bst");
+  save_string (work, "ENTRY {author} {} {}\n");
+  QVERIFY (bibtex_cache_key ("local", stub_bib, cites) != k2);
+  remove (work);
+  QVERIFY (bibtex_cache_key ("local", stub_bib, cites) == k2);
+  set_env ("BSTINPUTS", "");
+}
+
+void
+TestBibtex::test_cached_bbl () {
+#if defined(OS_WIN) || defined(OS_MINGW)
+  QSKIP ("the stub bibtex is a shell script");
+#endif
+  tree   cites= tuple ("a");
+  string key  = bibtex_cache_key ("plain", stub_bib, cites);
+  url    bbl  = bibtex_bbl ("plain", stub_bib, cites, key);
+  QCOMPARE (stub_runs (), 1);
+  string s;
+  QVERIFY (!load_string (bbl, s, false));
+  QVERIFY (starts (s, "\\begin{thebibliography}"));
+
+  url again= bibtex_bbl ("plain", stub_bib, cites, key);
+  QCOMPARE (stub_runs (), 1);
+  QVERIFY (exists (again));
+  // the warnings are replayed from the log of the first run
+  url    cache ("$TEXMACS_HOME_PATH/system/cache/bibtex");
+  string log;
+  QVERIFY (!load_string (cache * (key * ".log"), log, false));
+  QVERIFY (occurs ("Warning--stub warning", log));
+
+  save_string (stub_bib, "@book{a, title={A modified}}\n");
+  string key2= bibtex_cache_key ("plain", stub_bib, cites);
+  QVERIFY (key2 != key);
+  (void) bibtex_bbl ("plain", stub_bib, cites, key2);
+  QCOMPARE (stub_runs (), 2);
+}
+
+void
+TestBibtex::test_failed_run () {
+#if defined(OS_WIN) || defined(OS_MINGW)
+  QSKIP ("the stub bibtex is a shell script");
+#endif
+  tree   cites= tuple ("b");
+  string key  = bibtex_cache_key ("broken", stub_bib, cites);
+  int    runs = stub_runs ();
+  (void) bibtex_bbl ("broken", stub_bib, cites, key);
+  (void) bibtex_bbl ("broken", stub_bib, cites, key);
+  QCOMPARE (stub_runs (), runs + 2);
+  url cache ("$TEXMACS_HOME_PATH/system/cache/bibtex");
+  QVERIFY (!exists (cache * (key * ".bbl")));
+}
+
+QTEST_MAIN (TestBibtex)
+#include "bibtex_test.moc"
@@ -0,0 +1,84 @@
+
+/******************************************************************************
+ * MODULE     : htmlout_test.cpp
+ * DESCRIPTION: tests on the streaming html output
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "Html/html.hpp"
+#include "base.hpp"
+#include "file.hpp"
+#include "sys_utils.hpp"
+#include "tree_helper.hpp"
+
+static string
+saved_html (tree t) {
+  url u= url_temp (".html");
+  if (save_html (u, t)) return "<error>";
+  string s;
+  load_string (u, s, false);
+  remove (u);
+  return s;
+}
+
+class TestHtmlOut : public QObject {
+  Q_OBJECT
+
+private slots:
+  void init () { init_lolly (); }
+  void test_save_html ();
+  void test_large_output ();
+  void test_split_pages ();
+};
+
+void
+TestHtmlOut::test_save_html () {
+  tree img  = tuple ("img", tuple ("@", tuple ("src", "\"x.png\"")));
+  tree body = tuple ("body", tuple ("p", "\"a &amp; b\""), tuple ("br"), img);
+  tree html = tuple ("*TOP*", tuple ("*DOCTYPE*", "html"),
+                     tuple ("html", body));
+  string out= saved_html (html);
+  qcompare (out, "<!DOCTYPE html>\n<html>\n<body>\n<p>\na &amp; b\n</p>\n"
+                 "<br />\n<img src=\"x.png\" />\n</body>\n</html>");
+  qcompare (saved_html (tuple ("span", tuple ("@", tuple ("hidden")), "\"x\"")),
+            "<span hidden>x</span>");
+  tree div= tuple ("div", tuple ("p", "\"a\""), tuple ("p", "\"b\""));
+  qcompare (saved_html (div), "<div>\n<p>\na\n</p>\n<p>\nb\n</p>\n</div>");
+  qcompare (saved_html (tuple ("div", "\"a\"", tuple ("span", "\"b\""))),
+            "<div>\na<span>b</span>\n</div>");
+}
+
+void
+TestHtmlOut::test_large_output () {
+  tree   div= tuple ("span");
+  string expected= "<span>";
+  for (int i= 0; i < 20000; i++) {
+    div << "\"0123456789\"";
+    expected << "0123456789";
+  }
+  expected << "</span>";
+  QCOMPARE (N (saved_html (div)), N (expected));
+  QVERIFY (saved_html (div) == expected);
+}
+
+void
+TestHtmlOut::test_split_pages () {
+  tree doc (DOCUMENT);
+  doc << "intro" << compound ("section", "A") << "a"
+      << compound ("section*", "B") << "b";
+  tree pages= html_split_pages (doc, "section");
+  QCOMPARE (N (pages), 3);
+  QVERIFY (pages[0] == tree (DOCUMENT, "intro"));
+  QVERIFY (pages[1] == tree (DOCUMENT, compound ("section", "A"), "a"));
+  QVERIFY (pages[2] == tree (DOCUMENT, compound ("section*", "B"), "b"));
+  QCOMPARE (N (html_split_pages (tree (DOCUMENT, "x"), "chapter")), 1);
+}
+
+QTEST_MAIN (TestHtmlOut)
+#include "htmlout_test.moc"
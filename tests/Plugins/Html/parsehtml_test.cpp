@@ -13,6 +13,7 @@
 #include "Html/html.hpp"
 #include "base.hpp"
 #include "convert.hpp"
+#include "file.hpp"
 #include "sys_utils.hpp"
 #include "tm_ostream.hpp"
 #include "tree_helper.hpp"
@@ -25,6 +26,8 @@ private slots:
   void init () { init_lolly (); }
   void test_html_p ();
   void test_html_title ();
+  void test_html_entities ();
+  void test_html_file ();
 };
 
 void
@@ -96,5 +99,39 @@ TestParseHTML::test_html_title () {
   QVERIFY (b_out.unbuffer () == c_out.unbuffer ());
 }
 
+void
+TestParseHTML::test_html_entities () {
+  QVERIFY (parse_html ("&eacute;&rarr;&NotEqualTilde;") ==
+           tuple (tree ("*TOP*"), tree ("\"\303\251\342\206\222"
+                                        "\342\211\202\314\270\"")));
+  QVERIFY (parse_html ("&amp;lt; &copy &unknown;") ==
+           tuple (tree ("*TOP*"), tree ("\"&lt; \302\251 &unknown;\"")));
+  QVERIFY (parse_html ("&#60;b&#62;") ==
+           tuple (tree ("*TOP*"), tree ("\"<b>\"")));
+}
+
+static tree
+parse_html_via_file (string s) {
+  url u= url_temp (".html");
+  if (save_string (u, s, false)) return "";
+  tree t= parse_html_file (u);
+  remove (u);
+  return t;
+}
+
+void
+TestParseHTML::test_html_file () {
+  // the streamed file is corrected in the same way as the parsed string
+  string docs[]= {
+      "<p>hello</p><p>hello</p>",
+      "<p>one<p>two<ul><li>a<li>b</ul>three<br>four</p>",
+      "<table><tr><td>a<td>b<tr><td>c</table><p>x<div>y</div>",
+      "<dl><dt>term<dd>definition<dt>other</dl><hr><img src=\"x.png\">",
+      "&eacute;&rarr;&amp;lt; &copy &unknown;&#60;b&#62;",
+      "<html><head><title>t</title></head><body>b</i></body></html>"};
+  for (int i= 0; i < (int) (sizeof (docs) / sizeof (string)); i++)
+    QVERIFY (parse_html_via_file (docs[i]) == parse_html (docs[i]));
+}
+
 QTEST_MAIN (TestParseHTML)
 #include "parsehtml_test.moc"
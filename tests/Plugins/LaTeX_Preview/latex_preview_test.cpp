@@ -0,0 +1,130 @@
+/******************************************************************************
+ * MODULE     : latex_preview_test.cpp
+ * DESCRIPTION: tests on the batched and cached LaTeX previews
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "LaTeX_Preview/latex_preview.hpp"
+#include "base.hpp"
+#include "convert.hpp"
+#include "file.hpp"
+#include "sys_utils.hpp"
+#include "tree_helper.hpp"
+
+static int stub_runs= 0;
+static url preview_home;
+
+static int
+count_previews (tree t) {
+  if (is_atomic (t)) return 0;
+  if (is_tuple (t, "\\latex_preview", 2)) return 1;
+  int r= 0;
+  for (int i= 0; i < N (t); i++)
+    r+= count_previews (t[i]);
+  return r;
+}
+
+static array<tree>
+stub_compiler (string s, tree t) {
+  (void) s;
+  stub_runs++;
+  array<tree> r;
+  for (int i= 0; i < count_previews (t); i++) {
+    tree raw (RAW_DATA, "%!PS stub " * as_string (stub_runs) * ":" *
+                            as_string (i));
+    r << tree (IMAGE, tuple (raw, "eps"), as_string (i + 1) * "pt", "10pt",
+               "", "");
+  }
+  return r;
+}
+
+static tree
+preview_document (string last) {
+  tree doc (CONCAT);
+  doc << "Some text " << tuple ("\\latex_preview", "foo", "a") << " and "
+      << tuple ("\\latex_preview", "bar", "b") << " and "
+      << tuple ("\\latex_preview", "foo", last);
+  return doc;
+}
+
+static string preview_source=
+    "\\documentclass{article}\n\\newcommand{\\foo}[1]{#1}\n"
+    "\\begin{document}\nSome text\n\\end{document}\n";
+
+class TestLatexPreview : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase ();
+  void cleanupTestCase () { set_latex_preview_compiler (NULL); }
+  void test_batched_compilation ();
+  void test_cached_pictures ();
+  void test_modified_snippet ();
+  void test_included_file ();
+};
+
+void
+TestLatexPreview::initTestCase () {
+  init_lolly ();
+  preview_home= url_temp ("_preview_home");
+  mkdir (preview_home);
+  mkdir (preview_home * "system");
+  mkdir (preview_home * "system/cache");
+  set_env ("TEXMACS_HOME_PATH", as_string (preview_home));
+  set_latex_preview_compiler (stub_compiler);
+}
+
+void
+TestLatexPreview::test_batched_compilation () {
+  array<tree> r= latex_preview (preview_source, preview_document ("c"));
+  QCOMPARE (stub_runs, 1);
+  QCOMPARE (N (r), 3);
+  QVERIFY (is_func (r[2], IMAGE, 5));
+  qcompare (as_string (r[2][1]), "3pt");
+}
+
+void
+TestLatexPreview::test_cached_pictures () {
+  array<tree> r= latex_preview (preview_source, preview_document ("c"));
+  QCOMPARE (stub_runs, 1);
+  QCOMPARE (N (r), 3);
+  qcompare (as_string (r[0][0][0][0]), "%!PS stub 1:0");
+  qcompare (as_string (r[2][1]), "3pt");
+  qcompare (as_string (r[2][2]), "10pt");
+}
+
+void
+TestLatexPreview::test_modified_snippet () {
+  array<tree> r= latex_preview (preview_source, preview_document ("d"));
+  QCOMPARE (stub_runs, 2);
+  QCOMPARE (N (r), 3);
+  qcompare (as_string (r[0][0][0][0]), "%!PS stub 2:0");
+  r= latex_preview (preview_source * "%", preview_document ("c"));
+  QCOMPARE (stub_runs, 2);
+}
+
+void
+TestLatexPreview::test_included_file () {
+  // files included from the directory of the document are part of the key
+  set_file_focus (preview_home * "doc.tm");
+  save_string (preview_home * "macros.tex", "\\newcommand{\\bar}{b}\n");
+  string source= "\\documentclass{article}\n\\input{macros}\n"
+                 "\\begin{document}\nSome text\n\\end{document}\n";
+  int runs= stub_runs;
+  (void) latex_preview (source, preview_document ("c"));
+  QCOMPARE (stub_runs, runs + 1);
+  (void) latex_preview (source, preview_document ("c"));
+  QCOMPARE (stub_runs, runs + 1);
+  save_string (preview_home * "macros.tex", "\\newcommand{\\bar}{bb}\n");
+  (void) latex_preview (source, preview_document ("c"));
+  QCOMPARE (stub_runs, runs + 2);
+}
+
+QTEST_MAIN (TestLatexPreview)
+#include "latex_preview_test.moc"
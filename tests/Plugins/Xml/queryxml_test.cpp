@@ -22,6 +22,8 @@ private slots:
   void init () { init_lolly (); }
   void test_find_first_element_by_name ();
   void test_parse_xml_length ();
+  void test_xml_index ();
+  void test_parse_xml_index ();
 };
 
 void
@@ -47,5 +49,51 @@ TestQueryXML::test_parse_xml_length () {
   QCOMPARE (parse_xml_length ("10pt"), 10);
 }
 
+void
+TestQueryXML::test_xml_index () {
+  tree t= parse_xml ("<svg width=\"10\"><g id=\"a\"><rect width=\"5\"/></g>"
+                     "<g id=\"b\"/><text>g</text></svg>");
+  xml_index idx (t);
+  QVERIFY (find_first_element_by_name (idx, "g") ==
+           find_first_element_by_name (t, "g"));
+  QVERIFY (find_first_element_by_name (idx, "svg") ==
+           find_first_element_by_name (t, "svg"));
+  QVERIFY (find_first_element_by_name (idx, "circle") == tree ());
+  QCOMPARE (N (find_elements_by_name (idx, "g")), 2);
+  QCOMPARE (N (find_elements_by_name (idx, "circle")), 0);
+  array<tree> wide= find_elements_by_attr (idx, "width");
+  QCOMPARE (N (wide), 2);
+  QVERIFY (wide[0] == find_first_element_by_name (t, "svg"));
+  array<tree> b= find_elements_by_attr (idx, "id", "b");
+  QCOMPARE (N (b), 1);
+  qcompare (get_attr_from_element (b[0], "id", ""), "b");
+  // attribute lists are not elements
+  QCOMPARE (N (find_elements_by_name (idx, "width")), 0);
+  QCOMPARE (N (find_elements_by_name (idx, "@")), 0);
+  QCOMPARE (N (find_elements_by_name (idx, "id")), 0);
+}
+
+void
+TestQueryXML::test_parse_xml_index () {
+  string s= "<svg width=\"10\"><g id=\"a\"><rect width=\"5\"/></g>"
+            "<g id=\"b\"/><text>g</text></svg>";
+  xml_index built= parse_xml_index (s);
+  xml_index idx (parse_xml (s));
+  QVERIFY (built->root == idx->root);
+  const char* names[]= {"*TOP*", "svg", "g", "rect", "text", "width", "@"};
+  for (int i= 0; i < (int) (sizeof (names) / sizeof (const char*)); i++)
+    QVERIFY (find_elements_by_name (built, names[i]) ==
+             find_elements_by_name (idx, names[i]));
+  QVERIFY (find_elements_by_attr (built, "width") ==
+           find_elements_by_attr (idx, "width"));
+  QVERIFY (find_elements_by_attr (built, "id", "a") ==
+           find_elements_by_attr (idx, "id", "a"));
+  // the indexed elements are the subtrees of the parsed tree
+  tree g= find_first_element_by_name (built, "g");
+  QCOMPARE (N (find_elements_by_name (built, "rect")), 1);
+  QVERIFY (g == find_first_element_by_name (built->root, "g"));
+  QVERIFY (N (g) == 3);
+}
+
 QTEST_MAIN (TestQueryXML)
 #include "queryxml_test.moc"
@@ -0,0 +1,126 @@
+
+/******************************************************************************
+ * MODULE     : streamxml_test.cpp
+ * DESCRIPTION: tests on the streaming xml parser
+ * COPYRIGHT  : (C) 2024  Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "Xml/xml.hpp"
+#include "base.hpp"
+#include "file.hpp"
+#include "sys_utils.hpp"
+#include "tree_helper.hpp"
+
+struct counting_consumer : public xml_consumer {
+  int    starts, ends;
+  string log;
+  counting_consumer () : starts (0), ends (0) {}
+  void start_element (string name, tree attrs) {
+    starts++;
+    log << "<" << name << ":" << as_string (N (attrs)) << ">";
+  }
+  void end_element (string name) {
+    ends++;
+    log << "</" << name << ">";
+  }
+  void characters (string s) { log << s; }
+};
+
+static string sample=
+    "<?xml version=\"1.0\"?>\r\n"
+    "<!DOCTYPE doc [<!ENTITY who \"world\"> <!ELEMENT doc ANY>]>\r\n"
+    "<doc lang=\"en\" note='a > b'>\r\n"
+    "  <p>Hello &who; &amp; &lt;friends&gt; &#65;&#x42;</p>\r\n"
+    "  <!-- a comment -->\r\n"
+    "  <img src=\"x.png\"/>\r\n"
+    "  <![CDATA[<raw> & data]]>\r\n"
+    "  <q>unclosed\r\n"
+    "</doc>";
+
+static tree
+stream_in_chunks (string s, int size) {
+  xml_tree_builder  builder;
+  xml_stream_parser parser (builder);
+  for (int i= 0; i < N (s); i+= size)
+    parser.feed (s (i, min (i + size, N (s))));
+  parser.finish ();
+  return builder.result ();
+}
+
+class TestStreamXML : public QObject {
+  Q_OBJECT
+
+private slots:
+  void init () { init_lolly (); }
+  void test_same_tree_as_parse_xml ();
+  void test_chunk_boundaries ();
+  void test_resumed_scan ();
+  void test_events ();
+  void test_file ();
+};
+
+void
+TestStreamXML::test_same_tree_as_parse_xml () {
+  QVERIFY (stream_in_chunks (sample, N (sample)) == parse_xml (sample));
+  QVERIFY (stream_in_chunks ("&amp;", 5) == parse_xml ("&amp;"));
+  QVERIFY (stream_in_chunks ("<a><b>x</a>y", 20) == parse_xml ("<a><b>x</a>y"));
+}
+
+void
+TestStreamXML::test_chunk_boundaries () {
+  tree expected= parse_xml (sample);
+  QVERIFY (stream_in_chunks (sample, 1) == expected);
+  QVERIFY (stream_in_chunks (sample, 3) == expected);
+  QVERIFY (stream_in_chunks (sample, 7) == expected);
+}
+
+void
+TestStreamXML::test_resumed_scan () {
+  // an incomplete token is scanned once, not again for each chunk
+  xml_tree_builder  builder;
+  xml_stream_parser parser (builder);
+  string            doc= "<a title='x > y' data=\"";
+  parser.feed (doc);
+  QCOMPARE (parser.scan, N (doc));
+  for (int i= 0; i < 100; i++) {
+    parser.feed ("0123456789");
+    QCOMPARE (parser.scan, N (doc) + 10 * (i + 1));
+  }
+  parser.feed ("\">text</a>");
+  QCOMPARE (parser.scan, 0);
+  parser.finish ();
+  string s= doc;
+  for (int i= 0; i < 100; i++)
+    s << "0123456789";
+  s << "\">text</a>";
+  QVERIFY (builder.result () == parse_xml (s));
+}
+
+void
+TestStreamXML::test_events () {
+  counting_consumer c;
+  stream_xml (string ("<a x=\"1\" y='2'><b/>t&lt;<c>u</a></z>"), c);
+  QCOMPARE (c.starts, 3);
+  QCOMPARE (c.ends, 3);
+  qcompare (c.log, "<a:2><b:0></b>t<<c:0>u</c></a>");
+}
+
+void
+TestStreamXML::test_file () {
+  url u= url_temp (".xml");
+  QVERIFY (!save_string (u, sample, false));
+  QVERIFY (parse_xml_file (u) == parse_xml (sample));
+  remove (u);
+  counting_consumer c;
+  QVERIFY (stream_xml_file (u, c));
+  QCOMPARE (c.starts, 0);
+}
+
+QTEST_MAIN (TestStreamXML)
+#include "streamxml_test.moc"
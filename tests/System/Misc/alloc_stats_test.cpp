@@ -0,0 +1,63 @@
+
+/******************************************************************************
+ * MODULE     : alloc_stats_test.cpp
+ * DESCRIPTION: tests on the accounting of allocations per subsystem
+ * COPYRIGHT  : (C) 2024 Darcy Shen
+ *******************************************************************************
+ * This software falls under the GNU general public license version 3 or later.
+ * It comes WITHOUT ANY WARRANTY WHATSOEVER. For details, see the file LICENSE
+ * in the root directory or <http://www.gnu.org/licenses/gpl-3.0.html>.
+ ******************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "alloc_stats.hpp"
+#include "base.hpp"
+
+class TestAllocStats : public QObject {
+  Q_OBJECT
+
+private slots:
+  void init () { init_lolly (); }
+  void test_hooks ();
+  void test_report ();
+  void test_sampling ();
+};
+
+void
+TestAllocStats::test_hooks () {
+  alloc_snapshot before= alloc_current ();
+  alloc_hook_new (ALLOC_BOX);
+  alloc_hook_new (ALLOC_BOX);
+  alloc_hook_delete (ALLOC_BOX);
+  alloc_snapshot after= alloc_current ();
+  QCOMPARE (after.live[ALLOC_BOX] - before.live[ALLOC_BOX], 1L);
+  QCOMPARE (after.total[ALLOC_BOX] - before.total[ALLOC_BOX], 2L);
+  alloc_hook_delete (ALLOC_BOX);
+}
+
+void
+TestAllocStats::test_report () {
+  scheme_tree r= alloc_report ();
+  QVERIFY (N (r) >= 1);
+  QCOMPARE (N (r[0]), ALLOC_SUBSYSTEMS + 2);
+  qcompare (r[0][2 + ALLOC_TREE][0]->label, "edit-tree-nodes");
+  qcompare (r[0][2 + ALLOC_STRING][0]->label, "edit-tree-atoms");
+  qcompare (r[0][2 + ALLOC_ARCHIVER][0]->label, "archiver");
+}
+
+void
+TestAllocStats::test_sampling () {
+  alloc_set_sampling (0);
+  alloc_sample ();
+  QCOMPARE (N (alloc_report ()), 1);
+  alloc_set_sampling (3600000);
+  alloc_sample ();
+  alloc_sample ();
+  QCOMPARE (N (alloc_report ()), 2);
+  alloc_set_sampling (0);
+  QCOMPARE (N (alloc_report ()), 1);
+}
+
+QTEST_MAIN (TestAllocStats)
+#include "alloc_stats_test.moc"
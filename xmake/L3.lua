@@ -33,6 +33,7 @@ local l3_files = {
     "$(projectdir)/src/System/Files/tm_file.cpp",
     "$(projectdir)/src/System/Link/tm_link.cpp",
     "$(projectdir)/src/System/Link/dyn_link.cpp",
+    "$(projectdir)/src/System/Misc/alloc_stats.cpp",
     "$(projectdir)/src/System/Misc/data_cache.cpp",
     "$(projectdir)/src/System/Misc/persistent.cpp",
     "$(projectdir)/src/System/Misc/tm_sys_utils.cpp",